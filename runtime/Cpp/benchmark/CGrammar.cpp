@@ -0,0 +1,842 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+// The serialized ATNs and names of the C grammar (C.bnf) used by the runtime tests of the Python target, taken from
+// the recognizers generated there (runtime/Python3/test/parser), so the benchmarks need no code generation.
+
+#include "CGrammar.h"
+
+namespace cgrammar {
+
+  const std::vector<uint16_t> serializedLexerATN = {
+    3, 1072, 54993, 33286, 44333, 17431, 44785, 36224, 43741, 2, 115, 1255, 8, 1, 4, 2, 9, 2, 4, 3, 9, 3, 4, 4, 9, 4,
+    4, 5, 9, 5, 4, 6, 9, 6, 4, 7, 9, 7, 4, 8, 9, 8, 4, 9, 9, 9, 4, 10, 9, 10, 4, 11, 9, 11, 4, 12, 9, 12, 4, 13, 9,
+    13, 4, 14, 9, 14, 4, 15, 9, 15, 4, 16, 9, 16, 4, 17, 9, 17, 4, 18, 9, 18, 4, 19, 9, 19, 4, 20, 9, 20, 4, 21, 9,
+    21, 4, 22, 9, 22, 4, 23, 9, 23, 4, 24, 9, 24, 4, 25, 9, 25, 4, 26, 9, 26, 4, 27, 9, 27, 4, 28, 9, 28, 4, 29, 9,
+    29, 4, 30, 9, 30, 4, 31, 9, 31, 4, 32, 9, 32, 4, 33, 9, 33, 4, 34, 9, 34, 4, 35, 9, 35, 4, 36, 9, 36, 4, 37, 9,
+    37, 4, 38, 9, 38, 4, 39, 9, 39, 4, 40, 9, 40, 4, 41, 9, 41, 4, 42, 9, 42, 4, 43, 9, 43, 4, 44, 9, 44, 4, 45, 9,
+    45, 4, 46, 9, 46, 4, 47, 9, 47, 4, 48, 9, 48, 4, 49, 9, 49, 4, 50, 9, 50, 4, 51, 9, 51, 4, 52, 9, 52, 4, 53, 9,
+    53, 4, 54, 9, 54, 4, 55, 9, 55, 4, 56, 9, 56, 4, 57, 9, 57, 4, 58, 9, 58, 4, 59, 9, 59, 4, 60, 9, 60, 4, 61, 9,
+    61, 4, 62, 9, 62, 4, 63, 9, 63, 4, 64, 9, 64, 4, 65, 9, 65, 4, 66, 9, 66, 4, 67, 9, 67, 4, 68, 9, 68, 4, 69, 9,
+    69, 4, 70, 9, 70, 4, 71, 9, 71, 4, 72, 9, 72, 4, 73, 9, 73, 4, 74, 9, 74, 4, 75, 9, 75, 4, 76, 9, 76, 4, 77, 9,
+    77, 4, 78, 9, 78, 4, 79, 9, 79, 4, 80, 9, 80, 4, 81, 9, 81, 4, 82, 9, 82, 4, 83, 9, 83, 4, 84, 9, 84, 4, 85, 9,
+    85, 4, 86, 9, 86, 4, 87, 9, 87, 4, 88, 9, 88, 4, 89, 9, 89, 4, 90, 9, 90, 4, 91, 9, 91, 4, 92, 9, 92, 4, 93, 9,
+    93, 4, 94, 9, 94, 4, 95, 9, 95, 4, 96, 9, 96, 4, 97, 9, 97, 4, 98, 9, 98, 4, 99, 9, 99, 4, 100, 9, 100, 4, 101,
+    9, 101, 4, 102, 9, 102, 4, 103, 9, 103, 4, 104, 9, 104, 4, 105, 9, 105, 4, 106, 9, 106, 4, 107, 9, 107, 4, 108,
+    9, 108, 4, 109, 9, 109, 4, 110, 9, 110, 4, 111, 9, 111, 4, 112, 9, 112, 4, 113, 9, 113, 4, 114, 9, 114, 4, 115,
+    9, 115, 4, 116, 9, 116, 4, 117, 9, 117, 4, 118, 9, 118, 4, 119, 9, 119, 4, 120, 9, 120, 4, 121, 9, 121, 4, 122,
+    9, 122, 4, 123, 9, 123, 4, 124, 9, 124, 4, 125, 9, 125, 4, 126, 9, 126, 4, 127, 9, 127, 4, 128, 9, 128, 4, 129,
+    9, 129, 4, 130, 9, 130, 4, 131, 9, 131, 4, 132, 9, 132, 4, 133, 9, 133, 4, 134, 9, 134, 4, 135, 9, 135, 4, 136,
+    9, 136, 4, 137, 9, 137, 4, 138, 9, 138, 4, 139, 9, 139, 4, 140, 9, 140, 4, 141, 9, 141, 4, 142, 9, 142, 4, 143,
+    9, 143, 4, 144, 9, 144, 4, 145, 9, 145, 4, 146, 9, 146, 4, 147, 9, 147, 4, 148, 9, 148, 4, 149, 9, 149, 4, 150,
+    9, 150, 4, 151, 9, 151, 4, 152, 9, 152, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 7, 3, 7, 3, 7, 3, 7,
+    3, 7, 3, 7, 3, 7, 3, 7, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 9, 3, 9, 3, 9, 3, 9,
+    3, 9, 3, 9, 3, 9, 3, 9, 3, 9, 3, 9, 3, 9, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10,
+    3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12,
+    3, 12, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 14,
+    3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 15, 3, 15, 3, 15, 3, 15, 3, 15, 3, 15, 3, 15, 3, 15, 3, 15,
+    3, 15, 3, 15, 3, 15, 3, 15, 3, 16, 3, 16, 3, 16, 3, 16, 3, 16, 3, 17, 3, 17, 3, 17, 3, 17, 3, 17, 3, 17, 3, 18,
+    3, 18, 3, 18, 3, 18, 3, 18, 3, 19, 3, 19, 3, 19, 3, 19, 3, 19, 3, 20, 3, 20, 3, 20, 3, 20, 3, 20, 3, 20, 3, 21,
+    3, 21, 3, 21, 3, 21, 3, 21, 3, 21, 3, 21, 3, 21, 3, 21, 3, 22, 3, 22, 3, 22, 3, 22, 3, 22, 3, 22, 3, 22, 3, 22,
+    3, 23, 3, 23, 3, 23, 3, 24, 3, 24, 3, 24, 3, 24, 3, 24, 3, 24, 3, 24, 3, 25, 3, 25, 3, 25, 3, 25, 3, 25, 3, 26,
+    3, 26, 3, 26, 3, 26, 3, 26, 3, 27, 3, 27, 3, 27, 3, 27, 3, 27, 3, 27, 3, 27, 3, 28, 3, 28, 3, 28, 3, 28, 3, 28,
+    3, 28, 3, 29, 3, 29, 3, 29, 3, 29, 3, 30, 3, 30, 3, 30, 3, 30, 3, 30, 3, 31, 3, 31, 3, 31, 3, 32, 3, 32, 3, 32,
+    3, 32, 3, 32, 3, 32, 3, 32, 3, 33, 3, 33, 3, 33, 3, 33, 3, 34, 3, 34, 3, 34, 3, 34, 3, 34, 3, 35, 3, 35, 3, 35,
+    3, 35, 3, 35, 3, 35, 3, 35, 3, 35, 3, 35, 3, 36, 3, 36, 3, 36, 3, 36, 3, 36, 3, 36, 3, 36, 3, 36, 3, 36, 3, 37,
+    3, 37, 3, 37, 3, 37, 3, 37, 3, 37, 3, 37, 3, 38, 3, 38, 3, 38, 3, 38, 3, 38, 3, 38, 3, 39, 3, 39, 3, 39, 3, 39,
+    3, 39, 3, 39, 3, 39, 3, 40, 3, 40, 3, 40, 3, 40, 3, 40, 3, 40, 3, 40, 3, 41, 3, 41, 3, 41, 3, 41, 3, 41, 3, 41,
+    3, 41, 3, 42, 3, 42, 3, 42, 3, 42, 3, 42, 3, 42, 3, 42, 3, 43, 3, 43, 3, 43, 3, 43, 3, 43, 3, 43, 3, 43, 3, 44,
+    3, 44, 3, 44, 3, 44, 3, 44, 3, 44, 3, 44, 3, 44, 3, 45, 3, 45, 3, 45, 3, 45, 3, 45, 3, 45, 3, 46, 3, 46, 3, 46,
+    3, 46, 3, 46, 3, 46, 3, 46, 3, 46, 3, 46, 3, 47, 3, 47, 3, 47, 3, 47, 3, 47, 3, 48, 3, 48, 3, 48, 3, 48, 3, 48,
+    3, 48, 3, 48, 3, 48, 3, 48, 3, 49, 3, 49, 3, 49, 3, 49, 3, 49, 3, 49, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50,
+    3, 50, 3, 50, 3, 50, 3, 51, 3, 51, 3, 51, 3, 51, 3, 51, 3, 51, 3, 51, 3, 51, 3, 51, 3, 52, 3, 52, 3, 52, 3, 52,
+    3, 52, 3, 52, 3, 52, 3, 52, 3, 53, 3, 53, 3, 53, 3, 53, 3, 53, 3, 53, 3, 54, 3, 54, 3, 54, 3, 54, 3, 54, 3, 54,
+    3, 54, 3, 54, 3, 54, 3, 55, 3, 55, 3, 55, 3, 55, 3, 55, 3, 55, 3, 55, 3, 55, 3, 55, 3, 56, 3, 56, 3, 56, 3, 56,
+    3, 56, 3, 56, 3, 56, 3, 56, 3, 56, 3, 56, 3, 56, 3, 57, 3, 57, 3, 57, 3, 57, 3, 57, 3, 57, 3, 57, 3, 57, 3, 57,
+    3, 57, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58,
+    3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 59, 3, 60, 3, 60,
+    3, 61, 3, 61, 3, 62, 3, 62, 3, 63, 3, 63, 3, 64, 3, 64, 3, 65, 3, 65, 3, 66, 3, 66, 3, 67, 3, 67, 3, 67, 3, 68,
+    3, 68, 3, 69, 3, 69, 3, 69, 3, 70, 3, 70, 3, 70, 3, 71, 3, 71, 3, 71, 3, 72, 3, 72, 3, 73, 3, 73, 3, 73, 3, 74,
+    3, 74, 3, 75, 3, 75, 3, 75, 3, 76, 3, 76, 3, 77, 3, 77, 3, 78, 3, 78, 3, 79, 3, 79, 3, 80, 3, 80, 3, 81, 3, 81,
+    3, 81, 3, 82, 3, 82, 3, 82, 3, 83, 3, 83, 3, 84, 3, 84, 3, 85, 3, 85, 3, 86, 3, 86, 3, 87, 3, 87, 3, 88, 3, 88,
+    3, 89, 3, 89, 3, 90, 3, 90, 3, 91, 3, 91, 3, 91, 3, 92, 3, 92, 3, 92, 3, 93, 3, 93, 3, 93, 3, 94, 3, 94, 3, 94,
+    3, 95, 3, 95, 3, 95, 3, 96, 3, 96, 3, 96, 3, 96, 3, 97, 3, 97, 3, 97, 3, 97, 3, 98, 3, 98, 3, 98, 3, 99, 3, 99,
+    3, 99, 3, 100, 3, 100, 3, 100, 3, 101, 3, 101, 3, 101, 3, 102, 3, 102, 3, 102, 3, 103, 3, 103, 3, 103, 3, 104, 3,
+    104, 3, 105, 3, 105, 3, 105, 3, 105, 3, 106, 3, 106, 3, 106, 7, 106, 897, 10, 106, 12, 106, 14, 106, 900, 11,
+    106, 3, 107, 3, 107, 5, 107, 904, 10, 107, 3, 108, 3, 108, 3, 109, 3, 109, 3, 110, 3, 110, 3, 110, 3, 110, 3,
+    110, 3, 110, 3, 110, 3, 110, 3, 110, 3, 110, 5, 110, 920, 10, 110, 3, 111, 3, 111, 3, 111, 3, 111, 3, 111, 3,
+    112, 3, 112, 3, 112, 5, 112, 930, 10, 112, 3, 113, 3, 113, 5, 113, 934, 10, 113, 3, 113, 3, 113, 5, 113, 938, 10,
+    113, 3, 113, 3, 113, 5, 113, 942, 10, 113, 5, 113, 944, 10, 113, 3, 114, 3, 114, 7, 114, 948, 10, 114, 12, 114,
+    14, 114, 951, 11, 114, 3, 115, 3, 115, 7, 115, 955, 10, 115, 12, 115, 14, 115, 958, 11, 115, 3, 116, 3, 116, 6,
+    116, 962, 10, 116, 13, 116, 14, 116, 963, 3, 117, 3, 117, 3, 117, 3, 118, 3, 118, 3, 119, 3, 119, 3, 120, 3, 120,
+    3, 121, 3, 121, 5, 121, 977, 10, 121, 3, 121, 3, 121, 3, 121, 3, 121, 3, 121, 5, 121, 984, 10, 121, 3, 121, 3,
+    121, 5, 121, 988, 10, 121, 5, 121, 990, 10, 121, 3, 122, 3, 122, 3, 123, 3, 123, 3, 124, 3, 124, 3, 124, 3, 124,
+    5, 124, 1000, 10, 124, 3, 125, 3, 125, 5, 125, 1004, 10, 125, 3, 126, 3, 126, 5, 126, 1008, 10, 126, 3, 126, 5,
+    126, 1011, 10, 126, 3, 126, 3, 126, 3, 126, 5, 126, 1016, 10, 126, 5, 126, 1018, 10, 126, 3, 127, 3, 127, 3, 127,
+    3, 127, 5, 127, 1024, 10, 127, 3, 127, 3, 127, 3, 127, 3, 127, 5, 127, 1030, 10, 127, 5, 127, 1032, 10, 127, 3,
+    128, 5, 128, 1035, 10, 128, 3, 128, 3, 128, 3, 128, 3, 128, 3, 128, 5, 128, 1042, 10, 128, 3, 129, 3, 129, 5,
+    129, 1046, 10, 129, 3, 129, 3, 129, 3, 129, 5, 129, 1051, 10, 129, 3, 129, 5, 129, 1054, 10, 129, 3, 130, 3, 130,
+    3, 131, 6, 131, 1059, 10, 131, 13, 131, 14, 131, 1060, 3, 132, 5, 132, 1064, 10, 132, 3, 132, 3, 132, 3, 132, 3,
+    132, 3, 132, 5, 132, 1071, 10, 132, 3, 133, 3, 133, 5, 133, 1075, 10, 133, 3, 133, 3, 133, 3, 133, 5, 133, 1080,
+    10, 133, 3, 133, 5, 133, 1083, 10, 133, 3, 134, 6, 134, 1086, 10, 134, 13, 134, 14, 134, 1087, 3, 135, 3, 135, 3,
+    136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3,
+    136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 3, 136, 5, 136, 1114, 10, 136, 3, 137, 6, 137, 1117, 10,
+    137, 13, 137, 14, 137, 1118, 3, 138, 3, 138, 5, 138, 1123, 10, 138, 3, 139, 3, 139, 3, 139, 3, 139, 5, 139, 1129,
+    10, 139, 3, 140, 3, 140, 3, 140, 3, 141, 3, 141, 3, 141, 3, 141, 3, 141, 3, 141, 3, 141, 3, 141, 3, 141, 3, 141,
+    3, 141, 5, 141, 1145, 10, 141, 3, 142, 3, 142, 3, 142, 3, 142, 6, 142, 1151, 10, 142, 13, 142, 14, 142, 1152, 3,
+    143, 5, 143, 1156, 10, 143, 3, 143, 3, 143, 5, 143, 1160, 10, 143, 3, 143, 3, 143, 3, 144, 3, 144, 3, 144, 5,
+    144, 1167, 10, 144, 3, 145, 6, 145, 1170, 10, 145, 13, 145, 14, 145, 1171, 3, 146, 3, 146, 5, 146, 1176, 10, 146,
+    3, 147, 3, 147, 5, 147, 1180, 10, 147, 3, 147, 3, 147, 5, 147, 1184, 10, 147, 3, 147, 3, 147, 7, 147, 1188, 10,
+    147, 12, 147, 14, 147, 1191, 11, 147, 3, 147, 3, 147, 3, 148, 3, 148, 5, 148, 1197, 10, 148, 3, 148, 3, 148, 3,
+    148, 3, 148, 3, 148, 3, 148, 3, 148, 3, 148, 3, 148, 7, 148, 1208, 10, 148, 12, 148, 14, 148, 1211, 11, 148, 3,
+    148, 3, 148, 3, 149, 6, 149, 1216, 10, 149, 13, 149, 14, 149, 1217, 3, 149, 3, 149, 3, 150, 3, 150, 5, 150, 1224,
+    10, 150, 3, 150, 5, 150, 1227, 10, 150, 3, 150, 3, 150, 3, 151, 3, 151, 3, 151, 3, 151, 7, 151, 1235, 10, 151,
+    12, 151, 14, 151, 1238, 11, 151, 3, 151, 3, 151, 3, 151, 3, 151, 3, 151, 3, 152, 3, 152, 3, 152, 3, 152, 7, 152,
+    1249, 10, 152, 12, 152, 14, 152, 1252, 11, 152, 3, 152, 3, 152, 3, 1236, 2, 153, 3, 3, 5, 4, 7, 5, 9, 6, 11, 7,
+    13, 8, 15, 9, 17, 10, 19, 11, 21, 12, 23, 13, 25, 14, 27, 15, 29, 16, 31, 17, 33, 18, 35, 19, 37, 20, 39, 21, 41,
+    22, 43, 23, 45, 24, 47, 25, 49, 26, 51, 27, 53, 28, 55, 29, 57, 30, 59, 31, 61, 32, 63, 33, 65, 34, 67, 35, 69,
+    36, 71, 37, 73, 38, 75, 39, 77, 40, 79, 41, 81, 42, 83, 43, 85, 44, 87, 45, 89, 46, 91, 47, 93, 48, 95, 49, 97,
+    50, 99, 51, 101, 52, 103, 53, 105, 54, 107, 55, 109, 56, 111, 57, 113, 58, 115, 59, 117, 60, 119, 61, 121, 62,
+    123, 63, 125, 64, 127, 65, 129, 66, 131, 67, 133, 68, 135, 69, 137, 70, 139, 71, 141, 72, 143, 73, 145, 74, 147,
+    75, 149, 76, 151, 77, 153, 78, 155, 79, 157, 80, 159, 81, 161, 82, 163, 83, 165, 84, 167, 85, 169, 86, 171, 87,
+    173, 88, 175, 89, 177, 90, 179, 91, 181, 92, 183, 93, 185, 94, 187, 95, 189, 96, 191, 97, 193, 98, 195, 99, 197,
+    100, 199, 101, 201, 102, 203, 103, 205, 104, 207, 105, 209, 106, 211, 107, 213, 2, 215, 2, 217, 2, 219, 2, 221,
+    2, 223, 108, 225, 2, 227, 2, 229, 2, 231, 2, 233, 2, 235, 2, 237, 2, 239, 2, 241, 2, 243, 2, 245, 2, 247, 2, 249,
+    2, 251, 2, 253, 2, 255, 2, 257, 2, 259, 2, 261, 2, 263, 2, 265, 2, 267, 2, 269, 2, 271, 2, 273, 2, 275, 2, 277,
+    2, 279, 2, 281, 2, 283, 2, 285, 109, 287, 2, 289, 2, 291, 2, 293, 110, 295, 111, 297, 112, 299, 113, 301, 114,
+    303, 115, 3, 2, 18, 5, 2, 67, 92, 97, 97, 99, 124, 3, 2, 50, 59, 4, 2, 90, 90, 122, 122, 3, 2, 51, 59, 3, 2, 50,
+    57, 5, 2, 50, 59, 67, 72, 99, 104, 4, 2, 87, 87, 119, 119, 4, 2, 78, 78, 110, 110, 4, 2, 45, 45, 47, 47, 6, 2,
+    72, 72, 78, 78, 104, 104, 110, 110, 6, 2, 12, 12, 15, 15, 41, 41, 94, 94, 12, 2, 36, 36, 41, 41, 65, 65, 94, 94,
+    99, 100, 104, 104, 112, 112, 116, 116, 118, 118, 120, 120, 5, 2, 78, 78, 87, 87, 119, 119, 6, 2, 12, 12, 15, 15,
+    36, 36, 94, 94, 4, 2, 12, 12, 15, 15, 4, 2, 11, 11, 34, 34, 1283, 2, 3, 3, 2, 2, 2, 2, 5, 3, 2, 2, 2, 2, 7, 3, 2,
+    2, 2, 2, 9, 3, 2, 2, 2, 2, 11, 3, 2, 2, 2, 2, 13, 3, 2, 2, 2, 2, 15, 3, 2, 2, 2, 2, 17, 3, 2, 2, 2, 2, 19, 3, 2,
+    2, 2, 2, 21, 3, 2, 2, 2, 2, 23, 3, 2, 2, 2, 2, 25, 3, 2, 2, 2, 2, 27, 3, 2, 2, 2, 2, 29, 3, 2, 2, 2, 2, 31, 3, 2,
+    2, 2, 2, 33, 3, 2, 2, 2, 2, 35, 3, 2, 2, 2, 2, 37, 3, 2, 2, 2, 2, 39, 3, 2, 2, 2, 2, 41, 3, 2, 2, 2, 2, 43, 3, 2,
+    2, 2, 2, 45, 3, 2, 2, 2, 2, 47, 3, 2, 2, 2, 2, 49, 3, 2, 2, 2, 2, 51, 3, 2, 2, 2, 2, 53, 3, 2, 2, 2, 2, 55, 3, 2,
+    2, 2, 2, 57, 3, 2, 2, 2, 2, 59, 3, 2, 2, 2, 2, 61, 3, 2, 2, 2, 2, 63, 3, 2, 2, 2, 2, 65, 3, 2, 2, 2, 2, 67, 3, 2,
+    2, 2, 2, 69, 3, 2, 2, 2, 2, 71, 3, 2, 2, 2, 2, 73, 3, 2, 2, 2, 2, 75, 3, 2, 2, 2, 2, 77, 3, 2, 2, 2, 2, 79, 3, 2,
+    2, 2, 2, 81, 3, 2, 2, 2, 2, 83, 3, 2, 2, 2, 2, 85, 3, 2, 2, 2, 2, 87, 3, 2, 2, 2, 2, 89, 3, 2, 2, 2, 2, 91, 3, 2,
+    2, 2, 2, 93, 3, 2, 2, 2, 2, 95, 3, 2, 2, 2, 2, 97, 3, 2, 2, 2, 2, 99, 3, 2, 2, 2, 2, 101, 3, 2, 2, 2, 2, 103, 3,
+    2, 2, 2, 2, 105, 3, 2, 2, 2, 2, 107, 3, 2, 2, 2, 2, 109, 3, 2, 2, 2, 2, 111, 3, 2, 2, 2, 2, 113, 3, 2, 2, 2, 2,
+    115, 3, 2, 2, 2, 2, 117, 3, 2, 2, 2, 2, 119, 3, 2, 2, 2, 2, 121, 3, 2, 2, 2, 2, 123, 3, 2, 2, 2, 2, 125, 3, 2, 2,
+    2, 2, 127, 3, 2, 2, 2, 2, 129, 3, 2, 2, 2, 2, 131, 3, 2, 2, 2, 2, 133, 3, 2, 2, 2, 2, 135, 3, 2, 2, 2, 2, 137, 3,
+    2, 2, 2, 2, 139, 3, 2, 2, 2, 2, 141, 3, 2, 2, 2, 2, 143, 3, 2, 2, 2, 2, 145, 3, 2, 2, 2, 2, 147, 3, 2, 2, 2, 2,
+    149, 3, 2, 2, 2, 2, 151, 3, 2, 2, 2, 2, 153, 3, 2, 2, 2, 2, 155, 3, 2, 2, 2, 2, 157, 3, 2, 2, 2, 2, 159, 3, 2, 2,
+    2, 2, 161, 3, 2, 2, 2, 2, 163, 3, 2, 2, 2, 2, 165, 3, 2, 2, 2, 2, 167, 3, 2, 2, 2, 2, 169, 3, 2, 2, 2, 2, 171, 3,
+    2, 2, 2, 2, 173, 3, 2, 2, 2, 2, 175, 3, 2, 2, 2, 2, 177, 3, 2, 2, 2, 2, 179, 3, 2, 2, 2, 2, 181, 3, 2, 2, 2, 2,
+    183, 3, 2, 2, 2, 2, 185, 3, 2, 2, 2, 2, 187, 3, 2, 2, 2, 2, 189, 3, 2, 2, 2, 2, 191, 3, 2, 2, 2, 2, 193, 3, 2, 2,
+    2, 2, 195, 3, 2, 2, 2, 2, 197, 3, 2, 2, 2, 2, 199, 3, 2, 2, 2, 2, 201, 3, 2, 2, 2, 2, 203, 3, 2, 2, 2, 2, 205, 3,
+    2, 2, 2, 2, 207, 3, 2, 2, 2, 2, 209, 3, 2, 2, 2, 2, 211, 3, 2, 2, 2, 2, 223, 3, 2, 2, 2, 2, 285, 3, 2, 2, 2, 2,
+    293, 3, 2, 2, 2, 2, 295, 3, 2, 2, 2, 2, 297, 3, 2, 2, 2, 2, 299, 3, 2, 2, 2, 2, 301, 3, 2, 2, 2, 2, 303, 3, 2, 2,
+    2, 3, 305, 3, 2, 2, 2, 5, 319, 3, 2, 2, 2, 7, 336, 3, 2, 2, 2, 9, 355, 3, 2, 2, 2, 11, 362, 3, 2, 2, 2, 13, 370,
+    3, 2, 2, 2, 15, 378, 3, 2, 2, 2, 17, 389, 3, 2, 2, 2, 19, 400, 3, 2, 2, 2, 21, 410, 3, 2, 2, 2, 23, 421, 3, 2, 2,
+    2, 25, 427, 3, 2, 2, 2, 27, 441, 3, 2, 2, 2, 29, 449, 3, 2, 2, 2, 31, 462, 3, 2, 2, 2, 33, 467, 3, 2, 2, 2, 35,
+    473, 3, 2, 2, 2, 37, 478, 3, 2, 2, 2, 39, 483, 3, 2, 2, 2, 41, 489, 3, 2, 2, 2, 43, 498, 3, 2, 2, 2, 45, 506, 3,
+    2, 2, 2, 47, 509, 3, 2, 2, 2, 49, 516, 3, 2, 2, 2, 51, 521, 3, 2, 2, 2, 53, 526, 3, 2, 2, 2, 55, 533, 3, 2, 2, 2,
+    57, 539, 3, 2, 2, 2, 59, 543, 3, 2, 2, 2, 61, 548, 3, 2, 2, 2, 63, 551, 3, 2, 2, 2, 65, 558, 3, 2, 2, 2, 67, 562,
+    3, 2, 2, 2, 69, 567, 3, 2, 2, 2, 71, 576, 3, 2, 2, 2, 73, 585, 3, 2, 2, 2, 75, 592, 3, 2, 2, 2, 77, 598, 3, 2, 2,
+    2, 79, 605, 3, 2, 2, 2, 81, 612, 3, 2, 2, 2, 83, 619, 3, 2, 2, 2, 85, 626, 3, 2, 2, 2, 87, 633, 3, 2, 2, 2, 89,
+    641, 3, 2, 2, 2, 91, 647, 3, 2, 2, 2, 93, 656, 3, 2, 2, 2, 95, 661, 3, 2, 2, 2, 97, 670, 3, 2, 2, 2, 99, 676, 3,
+    2, 2, 2, 101, 685, 3, 2, 2, 2, 103, 694, 3, 2, 2, 2, 105, 702, 3, 2, 2, 2, 107, 708, 3, 2, 2, 2, 109, 717, 3, 2,
+    2, 2, 111, 726, 3, 2, 2, 2, 113, 737, 3, 2, 2, 2, 115, 747, 3, 2, 2, 2, 117, 762, 3, 2, 2, 2, 119, 776, 3, 2, 2,
+    2, 121, 778, 3, 2, 2, 2, 123, 780, 3, 2, 2, 2, 125, 782, 3, 2, 2, 2, 127, 784, 3, 2, 2, 2, 129, 786, 3, 2, 2, 2,
+    131, 788, 3, 2, 2, 2, 133, 790, 3, 2, 2, 2, 135, 793, 3, 2, 2, 2, 137, 795, 3, 2, 2, 2, 139, 798, 3, 2, 2, 2,
+    141, 801, 3, 2, 2, 2, 143, 804, 3, 2, 2, 2, 145, 806, 3, 2, 2, 2, 147, 809, 3, 2, 2, 2, 149, 811, 3, 2, 2, 2,
+    151, 814, 3, 2, 2, 2, 153, 816, 3, 2, 2, 2, 155, 818, 3, 2, 2, 2, 157, 820, 3, 2, 2, 2, 159, 822, 3, 2, 2, 2,
+    161, 824, 3, 2, 2, 2, 163, 827, 3, 2, 2, 2, 165, 830, 3, 2, 2, 2, 167, 832, 3, 2, 2, 2, 169, 834, 3, 2, 2, 2,
+    171, 836, 3, 2, 2, 2, 173, 838, 3, 2, 2, 2, 175, 840, 3, 2, 2, 2, 177, 842, 3, 2, 2, 2, 179, 844, 3, 2, 2, 2,
+    181, 846, 3, 2, 2, 2, 183, 849, 3, 2, 2, 2, 185, 852, 3, 2, 2, 2, 187, 855, 3, 2, 2, 2, 189, 858, 3, 2, 2, 2,
+    191, 861, 3, 2, 2, 2, 193, 865, 3, 2, 2, 2, 195, 869, 3, 2, 2, 2, 197, 872, 3, 2, 2, 2, 199, 875, 3, 2, 2, 2,
+    201, 878, 3, 2, 2, 2, 203, 881, 3, 2, 2, 2, 205, 884, 3, 2, 2, 2, 207, 887, 3, 2, 2, 2, 209, 889, 3, 2, 2, 2,
+    211, 893, 3, 2, 2, 2, 213, 903, 3, 2, 2, 2, 215, 905, 3, 2, 2, 2, 217, 907, 3, 2, 2, 2, 219, 919, 3, 2, 2, 2,
+    221, 921, 3, 2, 2, 2, 223, 929, 3, 2, 2, 2, 225, 943, 3, 2, 2, 2, 227, 945, 3, 2, 2, 2, 229, 952, 3, 2, 2, 2,
+    231, 959, 3, 2, 2, 2, 233, 965, 3, 2, 2, 2, 235, 968, 3, 2, 2, 2, 237, 970, 3, 2, 2, 2, 239, 972, 3, 2, 2, 2,
+    241, 989, 3, 2, 2, 2, 243, 991, 3, 2, 2, 2, 245, 993, 3, 2, 2, 2, 247, 999, 3, 2, 2, 2, 249, 1003, 3, 2, 2, 2,
+    251, 1017, 3, 2, 2, 2, 253, 1031, 3, 2, 2, 2, 255, 1041, 3, 2, 2, 2, 257, 1053, 3, 2, 2, 2, 259, 1055, 3, 2, 2,
+    2, 261, 1058, 3, 2, 2, 2, 263, 1070, 3, 2, 2, 2, 265, 1082, 3, 2, 2, 2, 267, 1085, 3, 2, 2, 2, 269, 1089, 3, 2,
+    2, 2, 271, 1113, 3, 2, 2, 2, 273, 1116, 3, 2, 2, 2, 275, 1122, 3, 2, 2, 2, 277, 1128, 3, 2, 2, 2, 279, 1130, 3,
+    2, 2, 2, 281, 1144, 3, 2, 2, 2, 283, 1146, 3, 2, 2, 2, 285, 1155, 3, 2, 2, 2, 287, 1166, 3, 2, 2, 2, 289, 1169,
+    3, 2, 2, 2, 291, 1175, 3, 2, 2, 2, 293, 1177, 3, 2, 2, 2, 295, 1194, 3, 2, 2, 2, 297, 1215, 3, 2, 2, 2, 299,
+    1226, 3, 2, 2, 2, 301, 1230, 3, 2, 2, 2, 303, 1244, 3, 2, 2, 2, 305, 306, 7, 97, 2, 2, 306, 307, 7, 97, 2, 2,
+    307, 308, 7, 103, 2, 2, 308, 309, 7, 122, 2, 2, 309, 310, 7, 118, 2, 2, 310, 311, 7, 103, 2, 2, 311, 312, 7, 112,
+    2, 2, 312, 313, 7, 117, 2, 2, 313, 314, 7, 107, 2, 2, 314, 315, 7, 113, 2, 2, 315, 316, 7, 112, 2, 2, 316, 317,
+    7, 97, 2, 2, 317, 318, 7, 97, 2, 2, 318, 4, 3, 2, 2, 2, 319, 320, 7, 97, 2, 2, 320, 321, 7, 97, 2, 2, 321, 322,
+    7, 100, 2, 2, 322, 323, 7, 119, 2, 2, 323, 324, 7, 107, 2, 2, 324, 325, 7, 110, 2, 2, 325, 326, 7, 118, 2, 2,
+    326, 327, 7, 107, 2, 2, 327, 328, 7, 112, 2, 2, 328, 329, 7, 97, 2, 2, 329, 330, 7, 120, 2, 2, 330, 331, 7, 99,
+    2, 2, 331, 332, 7, 97, 2, 2, 332, 333, 7, 99, 2, 2, 333, 334, 7, 116, 2, 2, 334, 335, 7, 105, 2, 2, 335, 6, 3, 2,
+    2, 2, 336, 337, 7, 97, 2, 2, 337, 338, 7, 97, 2, 2, 338, 339, 7, 100, 2, 2, 339, 340, 7, 119, 2, 2, 340, 341, 7,
+    107, 2, 2, 341, 342, 7, 110, 2, 2, 342, 343, 7, 118, 2, 2, 343, 344, 7, 107, 2, 2, 344, 345, 7, 112, 2, 2, 345,
+    346, 7, 97, 2, 2, 346, 347, 7, 113, 2, 2, 347, 348, 7, 104, 2, 2, 348, 349, 7, 104, 2, 2, 349, 350, 7, 117, 2, 2,
+    350, 351, 7, 103, 2, 2, 351, 352, 7, 118, 2, 2, 352, 353, 7, 113, 2, 2, 353, 354, 7, 104, 2, 2, 354, 8, 3, 2, 2,
+    2, 355, 356, 7, 97, 2, 2, 356, 357, 7, 97, 2, 2, 357, 358, 7, 111, 2, 2, 358, 359, 7, 51, 2, 2, 359, 360, 7, 52,
+    2, 2, 360, 361, 7, 58, 2, 2, 361, 10, 3, 2, 2, 2, 362, 363, 7, 97, 2, 2, 363, 364, 7, 97, 2, 2, 364, 365, 7, 111,
+    2, 2, 365, 366, 7, 51, 2, 2, 366, 367, 7, 52, 2, 2, 367, 368, 7, 58, 2, 2, 368, 369, 7, 102, 2, 2, 369, 12, 3, 2,
+    2, 2, 370, 371, 7, 97, 2, 2, 371, 372, 7, 97, 2, 2, 372, 373, 7, 111, 2, 2, 373, 374, 7, 51, 2, 2, 374, 375, 7,
+    52, 2, 2, 375, 376, 7, 58, 2, 2, 376, 377, 7, 107, 2, 2, 377, 14, 3, 2, 2, 2, 378, 379, 7, 97, 2, 2, 379, 380, 7,
+    97, 2, 2, 380, 381, 7, 118, 2, 2, 381, 382, 7, 123, 2, 2, 382, 383, 7, 114, 2, 2, 383, 384, 7, 103, 2, 2, 384,
+    385, 7, 113, 2, 2, 385, 386, 7, 104, 2, 2, 386, 387, 7, 97, 2, 2, 387, 388, 7, 97, 2, 2, 388, 16, 3, 2, 2, 2,
+    389, 390, 7, 97, 2, 2, 390, 391, 7, 97, 2, 2, 391, 392, 7, 107, 2, 2, 392, 393, 7, 112, 2, 2, 393, 394, 7, 110,
+    2, 2, 394, 395, 7, 107, 2, 2, 395, 396, 7, 112, 2, 2, 396, 397, 7, 103, 2, 2, 397, 398, 7, 97, 2, 2, 398, 399, 7,
+    97, 2, 2, 399, 18, 3, 2, 2, 2, 400, 401, 7, 97, 2, 2, 401, 402, 7, 97, 2, 2, 402, 403, 7, 117, 2, 2, 403, 404, 7,
+    118, 2, 2, 404, 405, 7, 102, 2, 2, 405, 406, 7, 101, 2, 2, 406, 407, 7, 99, 2, 2, 407, 408, 7, 110, 2, 2, 408,
+    409, 7, 110, 2, 2, 409, 20, 3, 2, 2, 2, 410, 411, 7, 97, 2, 2, 411, 412, 7, 97, 2, 2, 412, 413, 7, 102, 2, 2,
+    413, 414, 7, 103, 2, 2, 414, 415, 7, 101, 2, 2, 415, 416, 7, 110, 2, 2, 416, 417, 7, 117, 2, 2, 417, 418, 7, 114,
+    2, 2, 418, 419, 7, 103, 2, 2, 419, 420, 7, 101, 2, 2, 420, 22, 3, 2, 2, 2, 421, 422, 7, 97, 2, 2, 422, 423, 7,
+    97, 2, 2, 423, 424, 7, 99, 2, 2, 424, 425, 7, 117, 2, 2, 425, 426, 7, 111, 2, 2, 426, 24, 3, 2, 2, 2, 427, 428,
+    7, 97, 2, 2, 428, 429, 7, 97, 2, 2, 429, 430, 7, 99, 2, 2, 430, 431, 7, 118, 2, 2, 431, 432, 7, 118, 2, 2, 432,
+    433, 7, 116, 2, 2, 433, 434, 7, 107, 2, 2, 434, 435, 7, 100, 2, 2, 435, 436, 7, 119, 2, 2, 436, 437, 7, 118, 2,
+    2, 437, 438, 7, 103, 2, 2, 438, 439, 7, 97, 2, 2, 439, 440, 7, 97, 2, 2, 440, 26, 3, 2, 2, 2, 441, 442, 7, 97, 2,
+    2, 442, 443, 7, 97, 2, 2, 443, 444, 7, 99, 2, 2, 444, 445, 7, 117, 2, 2, 445, 446, 7, 111, 2, 2, 446, 447, 7, 97,
+    2, 2, 447, 448, 7, 97, 2, 2, 448, 28, 3, 2, 2, 2, 449, 450, 7, 97, 2, 2, 450, 451, 7, 97, 2, 2, 451, 452, 7, 120,
+    2, 2, 452, 453, 7, 113, 2, 2, 453, 454, 7, 110, 2, 2, 454, 455, 7, 99, 2, 2, 455, 456, 7, 118, 2, 2, 456, 457, 7,
+    107, 2, 2, 457, 458, 7, 110, 2, 2, 458, 459, 7, 103, 2, 2, 459, 460, 7, 97, 2, 2, 460, 461, 7, 97, 2, 2, 461, 30,
+    3, 2, 2, 2, 462, 463, 7, 99, 2, 2, 463, 464, 7, 119, 2, 2, 464, 465, 7, 118, 2, 2, 465, 466, 7, 113, 2, 2, 466,
+    32, 3, 2, 2, 2, 467, 468, 7, 100, 2, 2, 468, 469, 7, 116, 2, 2, 469, 470, 7, 103, 2, 2, 470, 471, 7, 99, 2, 2,
+    471, 472, 7, 109, 2, 2, 472, 34, 3, 2, 2, 2, 473, 474, 7, 101, 2, 2, 474, 475, 7, 99, 2, 2, 475, 476, 7, 117, 2,
+    2, 476, 477, 7, 103, 2, 2, 477, 36, 3, 2, 2, 2, 478, 479, 7, 101, 2, 2, 479, 480, 7, 106, 2, 2, 480, 481, 7, 99,
+    2, 2, 481, 482, 7, 116, 2, 2, 482, 38, 3, 2, 2, 2, 483, 484, 7, 101, 2, 2, 484, 485, 7, 113, 2, 2, 485, 486, 7,
+    112, 2, 2, 486, 487, 7, 117, 2, 2, 487, 488, 7, 118, 2, 2, 488, 40, 3, 2, 2, 2, 489, 490, 7, 101, 2, 2, 490, 491,
+    7, 113, 2, 2, 491, 492, 7, 112, 2, 2, 492, 493, 7, 118, 2, 2, 493, 494, 7, 107, 2, 2, 494, 495, 7, 112, 2, 2,
+    495, 496, 7, 119, 2, 2, 496, 497, 7, 103, 2, 2, 497, 42, 3, 2, 2, 2, 498, 499, 7, 102, 2, 2, 499, 500, 7, 103, 2,
+    2, 500, 501, 7, 104, 2, 2, 501, 502, 7, 99, 2, 2, 502, 503, 7, 119, 2, 2, 503, 504, 7, 110, 2, 2, 504, 505, 7,
+    118, 2, 2, 505, 44, 3, 2, 2, 2, 506, 507, 7, 102, 2, 2, 507, 508, 7, 113, 2, 2, 508, 46, 3, 2, 2, 2, 509, 510, 7,
+    102, 2, 2, 510, 511, 7, 113, 2, 2, 511, 512, 7, 119, 2, 2, 512, 513, 7, 100, 2, 2, 513, 514, 7, 110, 2, 2, 514,
+    515, 7, 103, 2, 2, 515, 48, 3, 2, 2, 2, 516, 517, 7, 103, 2, 2, 517, 518, 7, 110, 2, 2, 518, 519, 7, 117, 2, 2,
+    519, 520, 7, 103, 2, 2, 520, 50, 3, 2, 2, 2, 521, 522, 7, 103, 2, 2, 522, 523, 7, 112, 2, 2, 523, 524, 7, 119, 2,
+    2, 524, 525, 7, 111, 2, 2, 525, 52, 3, 2, 2, 2, 526, 527, 7, 103, 2, 2, 527, 528, 7, 122, 2, 2, 528, 529, 7, 118,
+    2, 2, 529, 530, 7, 103, 2, 2, 530, 531, 7, 116, 2, 2, 531, 532, 7, 112, 2, 2, 532, 54, 3, 2, 2, 2, 533, 534, 7,
+    104, 2, 2, 534, 535, 7, 110, 2, 2, 535, 536, 7, 113, 2, 2, 536, 537, 7, 99, 2, 2, 537, 538, 7, 118, 2, 2, 538,
+    56, 3, 2, 2, 2, 539, 540, 7, 104, 2, 2, 540, 541, 7, 113, 2, 2, 541, 542, 7, 116, 2, 2, 542, 58, 3, 2, 2, 2, 543,
+    544, 7, 105, 2, 2, 544, 545, 7, 113, 2, 2, 545, 546, 7, 118, 2, 2, 546, 547, 7, 113, 2, 2, 547, 60, 3, 2, 2, 2,
+    548, 549, 7, 107, 2, 2, 549, 550, 7, 104, 2, 2, 550, 62, 3, 2, 2, 2, 551, 552, 7, 107, 2, 2, 552, 553, 7, 112, 2,
+    2, 553, 554, 7, 110, 2, 2, 554, 555, 7, 107, 2, 2, 555, 556, 7, 112, 2, 2, 556, 557, 7, 103, 2, 2, 557, 64, 3, 2,
+    2, 2, 558, 559, 7, 107, 2, 2, 559, 560, 7, 112, 2, 2, 560, 561, 7, 118, 2, 2, 561, 66, 3, 2, 2, 2, 562, 563, 7,
+    110, 2, 2, 563, 564, 7, 113, 2, 2, 564, 565, 7, 112, 2, 2, 565, 566, 7, 105, 2, 2, 566, 68, 3, 2, 2, 2, 567, 568,
+    7, 116, 2, 2, 568, 569, 7, 103, 2, 2, 569, 570, 7, 105, 2, 2, 570, 571, 7, 107, 2, 2, 571, 572, 7, 117, 2, 2,
+    572, 573, 7, 118, 2, 2, 573, 574, 7, 103, 2, 2, 574, 575, 7, 116, 2, 2, 575, 70, 3, 2, 2, 2, 576, 577, 7, 116, 2,
+    2, 577, 578, 7, 103, 2, 2, 578, 579, 7, 117, 2, 2, 579, 580, 7, 118, 2, 2, 580, 581, 7, 116, 2, 2, 581, 582, 7,
+    107, 2, 2, 582, 583, 7, 101, 2, 2, 583, 584, 7, 118, 2, 2, 584, 72, 3, 2, 2, 2, 585, 586, 7, 116, 2, 2, 586, 587,
+    7, 103, 2, 2, 587, 588, 7, 118, 2, 2, 588, 589, 7, 119, 2, 2, 589, 590, 7, 116, 2, 2, 590, 591, 7, 112, 2, 2,
+    591, 74, 3, 2, 2, 2, 592, 593, 7, 117, 2, 2, 593, 594, 7, 106, 2, 2, 594, 595, 7, 113, 2, 2, 595, 596, 7, 116, 2,
+    2, 596, 597, 7, 118, 2, 2, 597, 76, 3, 2, 2, 2, 598, 599, 7, 117, 2, 2, 599, 600, 7, 107, 2, 2, 600, 601, 7, 105,
+    2, 2, 601, 602, 7, 112, 2, 2, 602, 603, 7, 103, 2, 2, 603, 604, 7, 102, 2, 2, 604, 78, 3, 2, 2, 2, 605, 606, 7,
+    117, 2, 2, 606, 607, 7, 107, 2, 2, 607, 608, 7, 124, 2, 2, 608, 609, 7, 103, 2, 2, 609, 610, 7, 113, 2, 2, 610,
+    611, 7, 104, 2, 2, 611, 80, 3, 2, 2, 2, 612, 613, 7, 117, 2, 2, 613, 614, 7, 118, 2, 2, 614, 615, 7, 99, 2, 2,
+    615, 616, 7, 118, 2, 2, 616, 617, 7, 107, 2, 2, 617, 618, 7, 101, 2, 2, 618, 82, 3, 2, 2, 2, 619, 620, 7, 117, 2,
+    2, 620, 621, 7, 118, 2, 2, 621, 622, 7, 116, 2, 2, 622, 623, 7, 119, 2, 2, 623, 624, 7, 101, 2, 2, 624, 625, 7,
+    118, 2, 2, 625, 84, 3, 2, 2, 2, 626, 627, 7, 117, 2, 2, 627, 628, 7, 121, 2, 2, 628, 629, 7, 107, 2, 2, 629, 630,
+    7, 118, 2, 2, 630, 631, 7, 101, 2, 2, 631, 632, 7, 106, 2, 2, 632, 86, 3, 2, 2, 2, 633, 634, 7, 118, 2, 2, 634,
+    635, 7, 123, 2, 2, 635, 636, 7, 114, 2, 2, 636, 637, 7, 103, 2, 2, 637, 638, 7, 102, 2, 2, 638, 639, 7, 103, 2,
+    2, 639, 640, 7, 104, 2, 2, 640, 88, 3, 2, 2, 2, 641, 642, 7, 119, 2, 2, 642, 643, 7, 112, 2, 2, 643, 644, 7, 107,
+    2, 2, 644, 645, 7, 113, 2, 2, 645, 646, 7, 112, 2, 2, 646, 90, 3, 2, 2, 2, 647, 648, 7, 119, 2, 2, 648, 649, 7,
+    112, 2, 2, 649, 650, 7, 117, 2, 2, 650, 651, 7, 107, 2, 2, 651, 652, 7, 105, 2, 2, 652, 653, 7, 112, 2, 2, 653,
+    654, 7, 103, 2, 2, 654, 655, 7, 102, 2, 2, 655, 92, 3, 2, 2, 2, 656, 657, 7, 120, 2, 2, 657, 658, 7, 113, 2, 2,
+    658, 659, 7, 107, 2, 2, 659, 660, 7, 102, 2, 2, 660, 94, 3, 2, 2, 2, 661, 662, 7, 120, 2, 2, 662, 663, 7, 113, 2,
+    2, 663, 664, 7, 110, 2, 2, 664, 665, 7, 99, 2, 2, 665, 666, 7, 118, 2, 2, 666, 667, 7, 107, 2, 2, 667, 668, 7,
+    110, 2, 2, 668, 669, 7, 103, 2, 2, 669, 96, 3, 2, 2, 2, 670, 671, 7, 121, 2, 2, 671, 672, 7, 106, 2, 2, 672, 673,
+    7, 107, 2, 2, 673, 674, 7, 110, 2, 2, 674, 675, 7, 103, 2, 2, 675, 98, 3, 2, 2, 2, 676, 677, 7, 97, 2, 2, 677,
+    678, 7, 67, 2, 2, 678, 679, 7, 110, 2, 2, 679, 680, 7, 107, 2, 2, 680, 681, 7, 105, 2, 2, 681, 682, 7, 112, 2, 2,
+    682, 683, 7, 99, 2, 2, 683, 684, 7, 117, 2, 2, 684, 100, 3, 2, 2, 2, 685, 686, 7, 97, 2, 2, 686, 687, 7, 67, 2,
+    2, 687, 688, 7, 110, 2, 2, 688, 689, 7, 107, 2, 2, 689, 690, 7, 105, 2, 2, 690, 691, 7, 112, 2, 2, 691, 692, 7,
+    113, 2, 2, 692, 693, 7, 104, 2, 2, 693, 102, 3, 2, 2, 2, 694, 695, 7, 97, 2, 2, 695, 696, 7, 67, 2, 2, 696, 697,
+    7, 118, 2, 2, 697, 698, 7, 113, 2, 2, 698, 699, 7, 111, 2, 2, 699, 700, 7, 107, 2, 2, 700, 701, 7, 101, 2, 2,
+    701, 104, 3, 2, 2, 2, 702, 703, 7, 97, 2, 2, 703, 704, 7, 68, 2, 2, 704, 705, 7, 113, 2, 2, 705, 706, 7, 113, 2,
+    2, 706, 707, 7, 110, 2, 2, 707, 106, 3, 2, 2, 2, 708, 709, 7, 97, 2, 2, 709, 710, 7, 69, 2, 2, 710, 711, 7, 113,
+    2, 2, 711, 712, 7, 111, 2, 2, 712, 713, 7, 114, 2, 2, 713, 714, 7, 110, 2, 2, 714, 715, 7, 103, 2, 2, 715, 716,
+    7, 122, 2, 2, 716, 108, 3, 2, 2, 2, 717, 718, 7, 97, 2, 2, 718, 719, 7, 73, 2, 2, 719, 720, 7, 103, 2, 2, 720,
+    721, 7, 112, 2, 2, 721, 722, 7, 103, 2, 2, 722, 723, 7, 116, 2, 2, 723, 724, 7, 107, 2, 2, 724, 725, 7, 101, 2,
+    2, 725, 110, 3, 2, 2, 2, 726, 727, 7, 97, 2, 2, 727, 728, 7, 75, 2, 2, 728, 729, 7, 111, 2, 2, 729, 730, 7, 99,
+    2, 2, 730, 731, 7, 105, 2, 2, 731, 732, 7, 107, 2, 2, 732, 733, 7, 112, 2, 2, 733, 734, 7, 99, 2, 2, 734, 735, 7,
+    116, 2, 2, 735, 736, 7, 123, 2, 2, 736, 112, 3, 2, 2, 2, 737, 738, 7, 97, 2, 2, 738, 739, 7, 80, 2, 2, 739, 740,
+    7, 113, 2, 2, 740, 741, 7, 116, 2, 2, 741, 742, 7, 103, 2, 2, 742, 743, 7, 118, 2, 2, 743, 744, 7, 119, 2, 2,
+    744, 745, 7, 116, 2, 2, 745, 746, 7, 112, 2, 2, 746, 114, 3, 2, 2, 2, 747, 748, 7, 97, 2, 2, 748, 749, 7, 85, 2,
+    2, 749, 750, 7, 118, 2, 2, 750, 751, 7, 99, 2, 2, 751, 752, 7, 118, 2, 2, 752, 753, 7, 107, 2, 2, 753, 754, 7,
+    101, 2, 2, 754, 755, 7, 97, 2, 2, 755, 756, 7, 99, 2, 2, 756, 757, 7, 117, 2, 2, 757, 758, 7, 117, 2, 2, 758,
+    759, 7, 103, 2, 2, 759, 760, 7, 116, 2, 2, 760, 761, 7, 118, 2, 2, 761, 116, 3, 2, 2, 2, 762, 763, 7, 97, 2, 2,
+    763, 764, 7, 86, 2, 2, 764, 765, 7, 106, 2, 2, 765, 766, 7, 116, 2, 2, 766, 767, 7, 103, 2, 2, 767, 768, 7, 99,
+    2, 2, 768, 769, 7, 102, 2, 2, 769, 770, 7, 97, 2, 2, 770, 771, 7, 110, 2, 2, 771, 772, 7, 113, 2, 2, 772, 773, 7,
+    101, 2, 2, 773, 774, 7, 99, 2, 2, 774, 775, 7, 110, 2, 2, 775, 118, 3, 2, 2, 2, 776, 777, 7, 42, 2, 2, 777, 120,
+    3, 2, 2, 2, 778, 779, 7, 43, 2, 2, 779, 122, 3, 2, 2, 2, 780, 781, 7, 93, 2, 2, 781, 124, 3, 2, 2, 2, 782, 783,
+    7, 95, 2, 2, 783, 126, 3, 2, 2, 2, 784, 785, 7, 125, 2, 2, 785, 128, 3, 2, 2, 2, 786, 787, 7, 127, 2, 2, 787,
+    130, 3, 2, 2, 2, 788, 789, 7, 62, 2, 2, 789, 132, 3, 2, 2, 2, 790, 791, 7, 62, 2, 2, 791, 792, 7, 63, 2, 2, 792,
+    134, 3, 2, 2, 2, 793, 794, 7, 64, 2, 2, 794, 136, 3, 2, 2, 2, 795, 796, 7, 64, 2, 2, 796, 797, 7, 63, 2, 2, 797,
+    138, 3, 2, 2, 2, 798, 799, 7, 62, 2, 2, 799, 800, 7, 62, 2, 2, 800, 140, 3, 2, 2, 2, 801, 802, 7, 64, 2, 2, 802,
+    803, 7, 64, 2, 2, 803, 142, 3, 2, 2, 2, 804, 805, 7, 45, 2, 2, 805, 144, 3, 2, 2, 2, 806, 807, 7, 45, 2, 2, 807,
+    808, 7, 45, 2, 2, 808, 146, 3, 2, 2, 2, 809, 810, 7, 47, 2, 2, 810, 148, 3, 2, 2, 2, 811, 812, 7, 47, 2, 2, 812,
+    813, 7, 47, 2, 2, 813, 150, 3, 2, 2, 2, 814, 815, 7, 44, 2, 2, 815, 152, 3, 2, 2, 2, 816, 817, 7, 49, 2, 2, 817,
+    154, 3, 2, 2, 2, 818, 819, 7, 39, 2, 2, 819, 156, 3, 2, 2, 2, 820, 821, 7, 40, 2, 2, 821, 158, 3, 2, 2, 2, 822,
+    823, 7, 126, 2, 2, 823, 160, 3, 2, 2, 2, 824, 825, 7, 40, 2, 2, 825, 826, 7, 40, 2, 2, 826, 162, 3, 2, 2, 2, 827,
+    828, 7, 126, 2, 2, 828, 829, 7, 126, 2, 2, 829, 164, 3, 2, 2, 2, 830, 831, 7, 96, 2, 2, 831, 166, 3, 2, 2, 2,
+    832, 833, 7, 35, 2, 2, 833, 168, 3, 2, 2, 2, 834, 835, 7, 128, 2, 2, 835, 170, 3, 2, 2, 2, 836, 837, 7, 65, 2, 2,
+    837, 172, 3, 2, 2, 2, 838, 839, 7, 60, 2, 2, 839, 174, 3, 2, 2, 2, 840, 841, 7, 61, 2, 2, 841, 176, 3, 2, 2, 2,
+    842, 843, 7, 46, 2, 2, 843, 178, 3, 2, 2, 2, 844, 845, 7, 63, 2, 2, 845, 180, 3, 2, 2, 2, 846, 847, 7, 44, 2, 2,
+    847, 848, 7, 63, 2, 2, 848, 182, 3, 2, 2, 2, 849, 850, 7, 49, 2, 2, 850, 851, 7, 63, 2, 2, 851, 184, 3, 2, 2, 2,
+    852, 853, 7, 39, 2, 2, 853, 854, 7, 63, 2, 2, 854, 186, 3, 2, 2, 2, 855, 856, 7, 45, 2, 2, 856, 857, 7, 63, 2, 2,
+    857, 188, 3, 2, 2, 2, 858, 859, 7, 47, 2, 2, 859, 860, 7, 63, 2, 2, 860, 190, 3, 2, 2, 2, 861, 862, 7, 62, 2, 2,
+    862, 863, 7, 62, 2, 2, 863, 864, 7, 63, 2, 2, 864, 192, 3, 2, 2, 2, 865, 866, 7, 64, 2, 2, 866, 867, 7, 64, 2, 2,
+    867, 868, 7, 63, 2, 2, 868, 194, 3, 2, 2, 2, 869, 870, 7, 40, 2, 2, 870, 871, 7, 63, 2, 2, 871, 196, 3, 2, 2, 2,
+    872, 873, 7, 96, 2, 2, 873, 874, 7, 63, 2, 2, 874, 198, 3, 2, 2, 2, 875, 876, 7, 126, 2, 2, 876, 877, 7, 63, 2,
+    2, 877, 200, 3, 2, 2, 2, 878, 879, 7, 63, 2, 2, 879, 880, 7, 63, 2, 2, 880, 202, 3, 2, 2, 2, 881, 882, 7, 35, 2,
+    2, 882, 883, 7, 63, 2, 2, 883, 204, 3, 2, 2, 2, 884, 885, 7, 47, 2, 2, 885, 886, 7, 64, 2, 2, 886, 206, 3, 2, 2,
+    2, 887, 888, 7, 48, 2, 2, 888, 208, 3, 2, 2, 2, 889, 890, 7, 48, 2, 2, 890, 891, 7, 48, 2, 2, 891, 892, 7, 48, 2,
+    2, 892, 210, 3, 2, 2, 2, 893, 898, 5, 213, 107, 2, 894, 897, 5, 213, 107, 2, 895, 897, 5, 217, 109, 2, 896, 894,
+    3, 2, 2, 2, 896, 895, 3, 2, 2, 2, 897, 900, 3, 2, 2, 2, 898, 896, 3, 2, 2, 2, 898, 899, 3, 2, 2, 2, 899, 212, 3,
+    2, 2, 2, 900, 898, 3, 2, 2, 2, 901, 904, 5, 215, 108, 2, 902, 904, 5, 219, 110, 2, 903, 901, 3, 2, 2, 2, 903,
+    902, 3, 2, 2, 2, 904, 214, 3, 2, 2, 2, 905, 906, 9, 2, 2, 2, 906, 216, 3, 2, 2, 2, 907, 908, 9, 3, 2, 2, 908,
+    218, 3, 2, 2, 2, 909, 910, 7, 94, 2, 2, 910, 911, 7, 119, 2, 2, 911, 912, 3, 2, 2, 2, 912, 920, 5, 221, 111, 2,
+    913, 914, 7, 94, 2, 2, 914, 915, 7, 87, 2, 2, 915, 916, 3, 2, 2, 2, 916, 917, 5, 221, 111, 2, 917, 918, 5, 221,
+    111, 2, 918, 920, 3, 2, 2, 2, 919, 909, 3, 2, 2, 2, 919, 913, 3, 2, 2, 2, 920, 220, 3, 2, 2, 2, 921, 922, 5, 239,
+    120, 2, 922, 923, 5, 239, 120, 2, 923, 924, 5, 239, 120, 2, 924, 925, 5, 239, 120, 2, 925, 222, 3, 2, 2, 2, 926,
+    930, 5, 225, 113, 2, 927, 930, 5, 249, 125, 2, 928, 930, 5, 271, 136, 2, 929, 926, 3, 2, 2, 2, 929, 927, 3, 2, 2,
+    2, 929, 928, 3, 2, 2, 2, 930, 224, 3, 2, 2, 2, 931, 933, 5, 227, 114, 2, 932, 934, 5, 241, 121, 2, 933, 932, 3,
+    2, 2, 2, 933, 934, 3, 2, 2, 2, 934, 944, 3, 2, 2, 2, 935, 937, 5, 229, 115, 2, 936, 938, 5, 241, 121, 2, 937,
+    936, 3, 2, 2, 2, 937, 938, 3, 2, 2, 2, 938, 944, 3, 2, 2, 2, 939, 941, 5, 231, 116, 2, 940, 942, 5, 241, 121, 2,
+    941, 940, 3, 2, 2, 2, 941, 942, 3, 2, 2, 2, 942, 944, 3, 2, 2, 2, 943, 931, 3, 2, 2, 2, 943, 935, 3, 2, 2, 2,
+    943, 939, 3, 2, 2, 2, 944, 226, 3, 2, 2, 2, 945, 949, 5, 235, 118, 2, 946, 948, 5, 217, 109, 2, 947, 946, 3, 2,
+    2, 2, 948, 951, 3, 2, 2, 2, 949, 947, 3, 2, 2, 2, 949, 950, 3, 2, 2, 2, 950, 228, 3, 2, 2, 2, 951, 949, 3, 2, 2,
+    2, 952, 956, 7, 50, 2, 2, 953, 955, 5, 237, 119, 2, 954, 953, 3, 2, 2, 2, 955, 958, 3, 2, 2, 2, 956, 954, 3, 2,
+    2, 2, 956, 957, 3, 2, 2, 2, 957, 230, 3, 2, 2, 2, 958, 956, 3, 2, 2, 2, 959, 961, 5, 233, 117, 2, 960, 962, 5,
+    239, 120, 2, 961, 960, 3, 2, 2, 2, 962, 963, 3, 2, 2, 2, 963, 961, 3, 2, 2, 2, 963, 964, 3, 2, 2, 2, 964, 232, 3,
+    2, 2, 2, 965, 966, 7, 50, 2, 2, 966, 967, 9, 4, 2, 2, 967, 234, 3, 2, 2, 2, 968, 969, 9, 5, 2, 2, 969, 236, 3, 2,
+    2, 2, 970, 971, 9, 6, 2, 2, 971, 238, 3, 2, 2, 2, 972, 973, 9, 7, 2, 2, 973, 240, 3, 2, 2, 2, 974, 976, 5, 243,
+    122, 2, 975, 977, 5, 245, 123, 2, 976, 975, 3, 2, 2, 2, 976, 977, 3, 2, 2, 2, 977, 990, 3, 2, 2, 2, 978, 979, 5,
+    243, 122, 2, 979, 980, 5, 247, 124, 2, 980, 990, 3, 2, 2, 2, 981, 983, 5, 245, 123, 2, 982, 984, 5, 243, 122, 2,
+    983, 982, 3, 2, 2, 2, 983, 984, 3, 2, 2, 2, 984, 990, 3, 2, 2, 2, 985, 987, 5, 247, 124, 2, 986, 988, 5, 243,
+    122, 2, 987, 986, 3, 2, 2, 2, 987, 988, 3, 2, 2, 2, 988, 990, 3, 2, 2, 2, 989, 974, 3, 2, 2, 2, 989, 978, 3, 2,
+    2, 2, 989, 981, 3, 2, 2, 2, 989, 985, 3, 2, 2, 2, 990, 242, 3, 2, 2, 2, 991, 992, 9, 8, 2, 2, 992, 244, 3, 2, 2,
+    2, 993, 994, 9, 9, 2, 2, 994, 246, 3, 2, 2, 2, 995, 996, 7, 110, 2, 2, 996, 1000, 7, 110, 2, 2, 997, 998, 7, 78,
+    2, 2, 998, 1000, 7, 78, 2, 2, 999, 995, 3, 2, 2, 2, 999, 997, 3, 2, 2, 2, 1000, 248, 3, 2, 2, 2, 1001, 1004, 5,
+    251, 126, 2, 1002, 1004, 5, 253, 127, 2, 1003, 1001, 3, 2, 2, 2, 1003, 1002, 3, 2, 2, 2, 1004, 250, 3, 2, 2, 2,
+    1005, 1007, 5, 255, 128, 2, 1006, 1008, 5, 257, 129, 2, 1007, 1006, 3, 2, 2, 2, 1007, 1008, 3, 2, 2, 2, 1008,
+    1010, 3, 2, 2, 2, 1009, 1011, 5, 269, 135, 2, 1010, 1009, 3, 2, 2, 2, 1010, 1011, 3, 2, 2, 2, 1011, 1018, 3, 2,
+    2, 2, 1012, 1013, 5, 261, 131, 2, 1013, 1015, 5, 257, 129, 2, 1014, 1016, 5, 269, 135, 2, 1015, 1014, 3, 2, 2, 2,
+    1015, 1016, 3, 2, 2, 2, 1016, 1018, 3, 2, 2, 2, 1017, 1005, 3, 2, 2, 2, 1017, 1012, 3, 2, 2, 2, 1018, 252, 3, 2,
+    2, 2, 1019, 1020, 5, 233, 117, 2, 1020, 1021, 5, 263, 132, 2, 1021, 1023, 5, 265, 133, 2, 1022, 1024, 5, 269,
+    135, 2, 1023, 1022, 3, 2, 2, 2, 1023, 1024, 3, 2, 2, 2, 1024, 1032, 3, 2, 2, 2, 1025, 1026, 5, 233, 117, 2, 1026,
+    1027, 5, 267, 134, 2, 1027, 1029, 5, 265, 133, 2, 1028, 1030, 5, 269, 135, 2, 1029, 1028, 3, 2, 2, 2, 1029, 1030,
+    3, 2, 2, 2, 1030, 1032, 3, 2, 2, 2, 1031, 1019, 3, 2, 2, 2, 1031, 1025, 3, 2, 2, 2, 1032, 254, 3, 2, 2, 2, 1033,
+    1035, 5, 261, 131, 2, 1034, 1033, 3, 2, 2, 2, 1034, 1035, 3, 2, 2, 2, 1035, 1036, 3, 2, 2, 2, 1036, 1037, 7, 48,
+    2, 2, 1037, 1042, 5, 261, 131, 2, 1038, 1039, 5, 261, 131, 2, 1039, 1040, 7, 48, 2, 2, 1040, 1042, 3, 2, 2, 2,
+    1041, 1034, 3, 2, 2, 2, 1041, 1038, 3, 2, 2, 2, 1042, 256, 3, 2, 2, 2, 1043, 1045, 7, 103, 2, 2, 1044, 1046, 5,
+    259, 130, 2, 1045, 1044, 3, 2, 2, 2, 1045, 1046, 3, 2, 2, 2, 1046, 1047, 3, 2, 2, 2, 1047, 1054, 5, 261, 131, 2,
+    1048, 1050, 7, 71, 2, 2, 1049, 1051, 5, 259, 130, 2, 1050, 1049, 3, 2, 2, 2, 1050, 1051, 3, 2, 2, 2, 1051, 1052,
+    3, 2, 2, 2, 1052, 1054, 5, 261, 131, 2, 1053, 1043, 3, 2, 2, 2, 1053, 1048, 3, 2, 2, 2, 1054, 258, 3, 2, 2, 2,
+    1055, 1056, 9, 10, 2, 2, 1056, 260, 3, 2, 2, 2, 1057, 1059, 5, 217, 109, 2, 1058, 1057, 3, 2, 2, 2, 1059, 1060,
+    3, 2, 2, 2, 1060, 1058, 3, 2, 2, 2, 1060, 1061, 3, 2, 2, 2, 1061, 262, 3, 2, 2, 2, 1062, 1064, 5, 267, 134, 2,
+    1063, 1062, 3, 2, 2, 2, 1063, 1064, 3, 2, 2, 2, 1064, 1065, 3, 2, 2, 2, 1065, 1066, 7, 48, 2, 2, 1066, 1071, 5,
+    267, 134, 2, 1067, 1068, 5, 267, 134, 2, 1068, 1069, 7, 48, 2, 2, 1069, 1071, 3, 2, 2, 2, 1070, 1063, 3, 2, 2, 2,
+    1070, 1067, 3, 2, 2, 2, 1071, 264, 3, 2, 2, 2, 1072, 1074, 7, 114, 2, 2, 1073, 1075, 5, 259, 130, 2, 1074, 1073,
+    3, 2, 2, 2, 1074, 1075, 3, 2, 2, 2, 1075, 1076, 3, 2, 2, 2, 1076, 1083, 5, 261, 131, 2, 1077, 1079, 7, 82, 2, 2,
+    1078, 1080, 5, 259, 130, 2, 1079, 1078, 3, 2, 2, 2, 1079, 1080, 3, 2, 2, 2, 1080, 1081, 3, 2, 2, 2, 1081, 1083,
+    5, 261, 131, 2, 1082, 1072, 3, 2, 2, 2, 1082, 1077, 3, 2, 2, 2, 1083, 266, 3, 2, 2, 2, 1084, 1086, 5, 239, 120,
+    2, 1085, 1084, 3, 2, 2, 2, 1086, 1087, 3, 2, 2, 2, 1087, 1085, 3, 2, 2, 2, 1087, 1088, 3, 2, 2, 2, 1088, 268, 3,
+    2, 2, 2, 1089, 1090, 9, 11, 2, 2, 1090, 270, 3, 2, 2, 2, 1091, 1092, 7, 41, 2, 2, 1092, 1093, 5, 273, 137, 2,
+    1093, 1094, 7, 41, 2, 2, 1094, 1114, 3, 2, 2, 2, 1095, 1096, 7, 78, 2, 2, 1096, 1097, 7, 41, 2, 2, 1097, 1098, 3,
+    2, 2, 2, 1098, 1099, 5, 273, 137, 2, 1099, 1100, 7, 41, 2, 2, 1100, 1114, 3, 2, 2, 2, 1101, 1102, 7, 119, 2, 2,
+    1102, 1103, 7, 41, 2, 2, 1103, 1104, 3, 2, 2, 2, 1104, 1105, 5, 273, 137, 2, 1105, 1106, 7, 41, 2, 2, 1106, 1114,
+    3, 2, 2, 2, 1107, 1108, 7, 87, 2, 2, 1108, 1109, 7, 41, 2, 2, 1109, 1110, 3, 2, 2, 2, 1110, 1111, 5, 273, 137, 2,
+    1111, 1112, 7, 41, 2, 2, 1112, 1114, 3, 2, 2, 2, 1113, 1091, 3, 2, 2, 2, 1113, 1095, 3, 2, 2, 2, 1113, 1101, 3,
+    2, 2, 2, 1113, 1107, 3, 2, 2, 2, 1114, 272, 3, 2, 2, 2, 1115, 1117, 5, 275, 138, 2, 1116, 1115, 3, 2, 2, 2, 1117,
+    1118, 3, 2, 2, 2, 1118, 1116, 3, 2, 2, 2, 1118, 1119, 3, 2, 2, 2, 1119, 274, 3, 2, 2, 2, 1120, 1123, 10, 12, 2,
+    2, 1121, 1123, 5, 277, 139, 2, 1122, 1120, 3, 2, 2, 2, 1122, 1121, 3, 2, 2, 2, 1123, 276, 3, 2, 2, 2, 1124, 1129,
+    5, 279, 140, 2, 1125, 1129, 5, 281, 141, 2, 1126, 1129, 5, 283, 142, 2, 1127, 1129, 5, 219, 110, 2, 1128, 1124,
+    3, 2, 2, 2, 1128, 1125, 3, 2, 2, 2, 1128, 1126, 3, 2, 2, 2, 1128, 1127, 3, 2, 2, 2, 1129, 278, 3, 2, 2, 2, 1130,
+    1131, 7, 94, 2, 2, 1131, 1132, 9, 13, 2, 2, 1132, 280, 3, 2, 2, 2, 1133, 1134, 7, 94, 2, 2, 1134, 1145, 5, 237,
+    119, 2, 1135, 1136, 7, 94, 2, 2, 1136, 1137, 5, 237, 119, 2, 1137, 1138, 5, 237, 119, 2, 1138, 1145, 3, 2, 2, 2,
+    1139, 1140, 7, 94, 2, 2, 1140, 1141, 5, 237, 119, 2, 1141, 1142, 5, 237, 119, 2, 1142, 1143, 5, 237, 119, 2,
+    1143, 1145, 3, 2, 2, 2, 1144, 1133, 3, 2, 2, 2, 1144, 1135, 3, 2, 2, 2, 1144, 1139, 3, 2, 2, 2, 1145, 282, 3, 2,
+    2, 2, 1146, 1147, 7, 94, 2, 2, 1147, 1148, 7, 122, 2, 2, 1148, 1150, 3, 2, 2, 2, 1149, 1151, 5, 239, 120, 2,
+    1150, 1149, 3, 2, 2, 2, 1151, 1152, 3, 2, 2, 2, 1152, 1150, 3, 2, 2, 2, 1152, 1153, 3, 2, 2, 2, 1153, 284, 3, 2,
+    2, 2, 1154, 1156, 5, 287, 144, 2, 1155, 1154, 3, 2, 2, 2, 1155, 1156, 3, 2, 2, 2, 1156, 1157, 3, 2, 2, 2, 1157,
+    1159, 7, 36, 2, 2, 1158, 1160, 5, 289, 145, 2, 1159, 1158, 3, 2, 2, 2, 1159, 1160, 3, 2, 2, 2, 1160, 1161, 3, 2,
+    2, 2, 1161, 1162, 7, 36, 2, 2, 1162, 286, 3, 2, 2, 2, 1163, 1164, 7, 119, 2, 2, 1164, 1167, 7, 58, 2, 2, 1165,
+    1167, 9, 14, 2, 2, 1166, 1163, 3, 2, 2, 2, 1166, 1165, 3, 2, 2, 2, 1167, 288, 3, 2, 2, 2, 1168, 1170, 5, 291,
+    146, 2, 1169, 1168, 3, 2, 2, 2, 1170, 1171, 3, 2, 2, 2, 1171, 1169, 3, 2, 2, 2, 1171, 1172, 3, 2, 2, 2, 1172,
+    290, 3, 2, 2, 2, 1173, 1176, 10, 15, 2, 2, 1174, 1176, 5, 277, 139, 2, 1175, 1173, 3, 2, 2, 2, 1175, 1174, 3, 2,
+    2, 2, 1176, 292, 3, 2, 2, 2, 1177, 1179, 7, 37, 2, 2, 1178, 1180, 5, 297, 149, 2, 1179, 1178, 3, 2, 2, 2, 1179,
+    1180, 3, 2, 2, 2, 1180, 1181, 3, 2, 2, 2, 1181, 1183, 5, 227, 114, 2, 1182, 1184, 5, 297, 149, 2, 1183, 1182, 3,
+    2, 2, 2, 1183, 1184, 3, 2, 2, 2, 1184, 1185, 3, 2, 2, 2, 1185, 1189, 5, 285, 143, 2, 1186, 1188, 10, 16, 2, 2,
+    1187, 1186, 3, 2, 2, 2, 1188, 1191, 3, 2, 2, 2, 1189, 1187, 3, 2, 2, 2, 1189, 1190, 3, 2, 2, 2, 1190, 1192, 3, 2,
+    2, 2, 1191, 1189, 3, 2, 2, 2, 1192, 1193, 8, 147, 2, 2, 1193, 294, 3, 2, 2, 2, 1194, 1196, 7, 37, 2, 2, 1195,
+    1197, 5, 297, 149, 2, 1196, 1195, 3, 2, 2, 2, 1196, 1197, 3, 2, 2, 2, 1197, 1198, 3, 2, 2, 2, 1198, 1199, 7, 114,
+    2, 2, 1199, 1200, 7, 116, 2, 2, 1200, 1201, 7, 99, 2, 2, 1201, 1202, 7, 105, 2, 2, 1202, 1203, 7, 111, 2, 2,
+    1203, 1204, 7, 99, 2, 2, 1204, 1205, 3, 2, 2, 2, 1205, 1209, 5, 297, 149, 2, 1206, 1208, 10, 16, 2, 2, 1207,
+    1206, 3, 2, 2, 2, 1208, 1211, 3, 2, 2, 2, 1209, 1207, 3, 2, 2, 2, 1209, 1210, 3, 2, 2, 2, 1210, 1212, 3, 2, 2, 2,
+    1211, 1209, 3, 2, 2, 2, 1212, 1213, 8, 148, 2, 2, 1213, 296, 3, 2, 2, 2, 1214, 1216, 9, 17, 2, 2, 1215, 1214, 3,
+    2, 2, 2, 1216, 1217, 3, 2, 2, 2, 1217, 1215, 3, 2, 2, 2, 1217, 1218, 3, 2, 2, 2, 1218, 1219, 3, 2, 2, 2, 1219,
+    1220, 8, 149, 2, 2, 1220, 298, 3, 2, 2, 2, 1221, 1223, 7, 15, 2, 2, 1222, 1224, 7, 12, 2, 2, 1223, 1222, 3, 2, 2,
+    2, 1223, 1224, 3, 2, 2, 2, 1224, 1227, 3, 2, 2, 2, 1225, 1227, 7, 12, 2, 2, 1226, 1221, 3, 2, 2, 2, 1226, 1225,
+    3, 2, 2, 2, 1227, 1228, 3, 2, 2, 2, 1228, 1229, 8, 150, 2, 2, 1229, 300, 3, 2, 2, 2, 1230, 1231, 7, 49, 2, 2,
+    1231, 1232, 7, 44, 2, 2, 1232, 1236, 3, 2, 2, 2, 1233, 1235, 11, 2, 2, 2, 1234, 1233, 3, 2, 2, 2, 1235, 1238, 3,
+    2, 2, 2, 1236, 1237, 3, 2, 2, 2, 1236, 1234, 3, 2, 2, 2, 1237, 1239, 3, 2, 2, 2, 1238, 1236, 3, 2, 2, 2, 1239,
+    1240, 7, 44, 2, 2, 1240, 1241, 7, 49, 2, 2, 1241, 1242, 3, 2, 2, 2, 1242, 1243, 8, 151, 2, 2, 1243, 302, 3, 2, 2,
+    2, 1244, 1245, 7, 49, 2, 2, 1245, 1246, 7, 49, 2, 2, 1246, 1250, 3, 2, 2, 2, 1247, 1249, 10, 16, 2, 2, 1248,
+    1247, 3, 2, 2, 2, 1249, 1252, 3, 2, 2, 2, 1250, 1248, 3, 2, 2, 2, 1250, 1251, 3, 2, 2, 2, 1251, 1253, 3, 2, 2, 2,
+    1252, 1250, 3, 2, 2, 2, 1253, 1254, 8, 152, 2, 2, 1254, 304, 3, 2, 2, 2, 61, 2, 896, 898, 903, 919, 929, 933,
+    937, 941, 943, 949, 956, 963, 976, 983, 987, 989, 999, 1003, 1007, 1010, 1015, 1017, 1023, 1029, 1031, 1034,
+    1041, 1045, 1050, 1053, 1060, 1063, 1070, 1074, 1079, 1082, 1087, 1113, 1118, 1122, 1128, 1144, 1152, 1155, 1159,
+    1166, 1171, 1175, 1179, 1183, 1189, 1196, 1209, 1217, 1223, 1226, 1236, 1250, 3, 8, 2, 2
+  };
+
+  const std::vector<uint16_t> serializedParserATN = {
+    3, 1072, 54993, 33286, 44333, 17431, 44785, 36224, 43741, 3, 115, 1257, 4, 2, 9, 2, 4, 3, 9, 3, 4, 4, 9, 4, 4, 5,
+    9, 5, 4, 6, 9, 6, 4, 7, 9, 7, 4, 8, 9, 8, 4, 9, 9, 9, 4, 10, 9, 10, 4, 11, 9, 11, 4, 12, 9, 12, 4, 13, 9, 13, 4,
+    14, 9, 14, 4, 15, 9, 15, 4, 16, 9, 16, 4, 17, 9, 17, 4, 18, 9, 18, 4, 19, 9, 19, 4, 20, 9, 20, 4, 21, 9, 21, 4,
+    22, 9, 22, 4, 23, 9, 23, 4, 24, 9, 24, 4, 25, 9, 25, 4, 26, 9, 26, 4, 27, 9, 27, 4, 28, 9, 28, 4, 29, 9, 29, 4,
+    30, 9, 30, 4, 31, 9, 31, 4, 32, 9, 32, 4, 33, 9, 33, 4, 34, 9, 34, 4, 35, 9, 35, 4, 36, 9, 36, 4, 37, 9, 37, 4,
+    38, 9, 38, 4, 39, 9, 39, 4, 40, 9, 40, 4, 41, 9, 41, 4, 42, 9, 42, 4, 43, 9, 43, 4, 44, 9, 44, 4, 45, 9, 45, 4,
+    46, 9, 46, 4, 47, 9, 47, 4, 48, 9, 48, 4, 49, 9, 49, 4, 50, 9, 50, 4, 51, 9, 51, 4, 52, 9, 52, 4, 53, 9, 53, 4,
+    54, 9, 54, 4, 55, 9, 55, 4, 56, 9, 56, 4, 57, 9, 57, 4, 58, 9, 58, 4, 59, 9, 59, 4, 60, 9, 60, 4, 61, 9, 61, 4,
+    62, 9, 62, 4, 63, 9, 63, 4, 64, 9, 64, 4, 65, 9, 65, 4, 66, 9, 66, 4, 67, 9, 67, 4, 68, 9, 68, 4, 69, 9, 69, 4,
+    70, 9, 70, 4, 71, 9, 71, 4, 72, 9, 72, 4, 73, 9, 73, 4, 74, 9, 74, 4, 75, 9, 75, 4, 76, 9, 76, 4, 77, 9, 77, 4,
+    78, 9, 78, 4, 79, 9, 79, 4, 80, 9, 80, 4, 81, 9, 81, 4, 82, 9, 82, 4, 83, 9, 83, 4, 84, 9, 84, 4, 85, 9, 85, 3,
+    2, 3, 2, 3, 2, 6, 2, 174, 10, 2, 13, 2, 14, 2, 175, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 5, 2, 184, 10, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 5, 2, 204,
+    10, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 7, 4, 219, 10, 4, 12, 4, 14,
+    4, 222, 11, 4, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 3, 5, 5, 5, 231, 10, 5, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 5, 6, 267, 10, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3,
+    6, 5, 6, 277, 10, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 3, 6, 7, 6, 290, 10, 6, 12, 6,
+    14, 6, 293, 11, 6, 3, 7, 3, 7, 3, 7, 3, 7, 3, 7, 3, 7, 7, 7, 301, 10, 7, 12, 7, 14, 7, 304, 11, 7, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 5, 8, 328, 10, 8, 3, 9, 3, 9, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3, 10, 3,
+    10, 5, 10, 344, 10, 10, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 3, 11, 7,
+    11, 358, 10, 11, 12, 11, 14, 11, 361, 11, 11, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 3, 12, 7,
+    12, 372, 10, 12, 12, 12, 14, 12, 375, 11, 12, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 3, 13, 7,
+    13, 386, 10, 13, 12, 13, 14, 13, 389, 11, 13, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 3,
+    14, 3, 14, 3, 14, 3, 14, 3, 14, 3, 14, 7, 14, 406, 10, 14, 12, 14, 14, 14, 409, 11, 14, 3, 15, 3, 15, 3, 15, 3,
+    15, 3, 15, 3, 15, 3, 15, 3, 15, 3, 15, 7, 15, 420, 10, 15, 12, 15, 14, 15, 423, 11, 15, 3, 16, 3, 16, 3, 16, 3,
+    16, 3, 16, 3, 16, 7, 16, 431, 10, 16, 12, 16, 14, 16, 434, 11, 16, 3, 17, 3, 17, 3, 17, 3, 17, 3, 17, 3, 17, 7,
+    17, 442, 10, 17, 12, 17, 14, 17, 445, 11, 17, 3, 18, 3, 18, 3, 18, 3, 18, 3, 18, 3, 18, 7, 18, 453, 10, 18, 12,
+    18, 14, 18, 456, 11, 18, 3, 19, 3, 19, 3, 19, 3, 19, 3, 19, 3, 19, 7, 19, 464, 10, 19, 12, 19, 14, 19, 467, 11,
+    19, 3, 20, 3, 20, 3, 20, 3, 20, 3, 20, 3, 20, 7, 20, 475, 10, 20, 12, 20, 14, 20, 478, 11, 20, 3, 21, 3, 21, 3,
+    21, 3, 21, 3, 21, 3, 21, 5, 21, 486, 10, 21, 3, 22, 3, 22, 3, 22, 3, 22, 3, 22, 5, 22, 493, 10, 22, 3, 23, 3, 23,
+    3, 24, 3, 24, 3, 24, 3, 24, 3, 24, 3, 24, 7, 24, 503, 10, 24, 12, 24, 14, 24, 506, 11, 24, 3, 25, 3, 25, 3, 26,
+    3, 26, 5, 26, 512, 10, 26, 3, 26, 3, 26, 3, 26, 5, 26, 517, 10, 26, 3, 27, 6, 27, 520, 10, 27, 13, 27, 14, 27,
+    521, 3, 28, 6, 28, 525, 10, 28, 13, 28, 14, 28, 526, 3, 29, 3, 29, 3, 29, 3, 29, 3, 29, 5, 29, 534, 10, 29, 3,
+    30, 3, 30, 3, 30, 3, 30, 3, 30, 3, 30, 7, 30, 542, 10, 30, 12, 30, 14, 30, 545, 11, 30, 3, 31, 3, 31, 3, 31, 3,
+    31, 3, 31, 5, 31, 552, 10, 31, 3, 32, 3, 32, 3, 33, 3, 33, 3, 33, 3, 33, 3, 33, 3, 33, 3, 33, 3, 33, 3, 33, 3,
+    33, 3, 33, 3, 33, 3, 33, 3, 33, 5, 33, 570, 10, 33, 3, 34, 3, 34, 5, 34, 574, 10, 34, 3, 34, 3, 34, 3, 34, 3, 34,
+    3, 34, 3, 34, 3, 34, 5, 34, 583, 10, 34, 3, 35, 3, 35, 3, 36, 3, 36, 3, 36, 3, 36, 3, 36, 7, 36, 592, 10, 36, 12,
+    36, 14, 36, 595, 11, 36, 3, 37, 3, 37, 5, 37, 599, 10, 37, 3, 37, 3, 37, 3, 37, 5, 37, 604, 10, 37, 3, 38, 3, 38,
+    5, 38, 608, 10, 38, 3, 38, 3, 38, 5, 38, 612, 10, 38, 5, 38, 614, 10, 38, 3, 39, 3, 39, 3, 39, 3, 39, 3, 39, 3,
+    39, 7, 39, 622, 10, 39, 12, 39, 14, 39, 625, 11, 39, 3, 40, 3, 40, 5, 40, 629, 10, 40, 3, 40, 3, 40, 5, 40, 633,
+    10, 40, 3, 41, 3, 41, 5, 41, 637, 10, 41, 3, 41, 3, 41, 3, 41, 3, 41, 3, 41, 3, 41, 5, 41, 645, 10, 41, 3, 41, 3,
+    41, 3, 41, 3, 41, 3, 41, 3, 41, 3, 41, 5, 41, 654, 10, 41, 3, 42, 3, 42, 3, 42, 3, 42, 3, 42, 3, 42, 7, 42, 662,
+    10, 42, 12, 42, 14, 42, 665, 11, 42, 3, 43, 3, 43, 3, 43, 3, 43, 3, 43, 5, 43, 672, 10, 43, 3, 44, 3, 44, 3, 45,
+    3, 45, 3, 45, 3, 45, 3, 45, 3, 46, 3, 46, 3, 47, 3, 47, 3, 47, 3, 47, 3, 47, 3, 47, 5, 47, 689, 10, 47, 3, 48, 3,
+    48, 3, 48, 3, 48, 3, 48, 3, 48, 3, 48, 3, 48, 3, 48, 3, 48, 5, 48, 701, 10, 48, 3, 49, 5, 49, 704, 10, 49, 3, 49,
+    3, 49, 7, 49, 708, 10, 49, 12, 49, 14, 49, 711, 11, 49, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 5, 50, 719, 10,
+    50, 3, 50, 3, 50, 3, 50, 5, 50, 724, 10, 50, 3, 50, 5, 50, 727, 10, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 5, 50,
+    734, 10, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 5, 50,
+    749, 10, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 3, 50, 5, 50, 761, 10, 50, 3, 50, 7,
+    50, 764, 10, 50, 12, 50, 14, 50, 767, 11, 50, 3, 51, 3, 51, 3, 51, 6, 51, 772, 10, 51, 13, 51, 14, 51, 773, 3,
+    51, 3, 51, 5, 51, 778, 10, 51, 3, 52, 3, 52, 3, 52, 3, 52, 3, 52, 3, 52, 3, 52, 3, 53, 3, 53, 3, 53, 7, 53, 790,
+    10, 53, 12, 53, 14, 53, 793, 11, 53, 3, 53, 5, 53, 796, 10, 53, 3, 54, 3, 54, 3, 54, 5, 54, 801, 10, 54, 3, 54,
+    5, 54, 804, 10, 54, 3, 54, 5, 54, 807, 10, 54, 3, 55, 3, 55, 3, 55, 3, 55, 3, 55, 7, 55, 814, 10, 55, 12, 55, 14,
+    55, 817, 11, 55, 3, 56, 3, 56, 5, 56, 821, 10, 56, 3, 56, 3, 56, 5, 56, 825, 10, 56, 3, 56, 3, 56, 3, 56, 5, 56,
+    830, 10, 56, 3, 56, 3, 56, 5, 56, 834, 10, 56, 3, 56, 5, 56, 837, 10, 56, 3, 57, 3, 57, 3, 57, 3, 57, 3, 57, 7,
+    57, 844, 10, 57, 12, 57, 14, 57, 847, 11, 57, 3, 58, 3, 58, 3, 58, 3, 58, 3, 58, 5, 58, 854, 10, 58, 3, 59, 3,
+    59, 3, 59, 3, 59, 3, 59, 3, 59, 7, 59, 862, 10, 59, 12, 59, 14, 59, 865, 11, 59, 3, 60, 3, 60, 3, 60, 3, 60, 3,
+    60, 5, 60, 872, 10, 60, 5, 60, 874, 10, 60, 3, 61, 3, 61, 3, 61, 3, 61, 3, 61, 3, 61, 7, 61, 882, 10, 61, 12, 61,
+    14, 61, 885, 11, 61, 3, 62, 3, 62, 5, 62, 889, 10, 62, 3, 63, 3, 63, 5, 63, 893, 10, 63, 3, 63, 3, 63, 7, 63,
+    897, 10, 63, 12, 63, 14, 63, 900, 11, 63, 5, 63, 902, 10, 63, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 7, 64, 909, 10,
+    64, 12, 64, 14, 64, 912, 11, 64, 3, 64, 3, 64, 5, 64, 916, 10, 64, 3, 64, 5, 64, 919, 10, 64, 3, 64, 3, 64, 3,
+    64, 3, 64, 5, 64, 925, 10, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3,
+    64, 3, 64, 3, 64, 5, 64, 941, 10, 64, 3, 64, 3, 64, 7, 64, 945, 10, 64, 12, 64, 14, 64, 948, 11, 64, 5, 64, 950,
+    10, 64, 3, 64, 3, 64, 3, 64, 5, 64, 955, 10, 64, 3, 64, 5, 64, 958, 10, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 5,
+    64, 965, 10, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3, 64, 3,
+    64, 3, 64, 3, 64, 3, 64, 5, 64, 984, 10, 64, 3, 64, 3, 64, 7, 64, 988, 10, 64, 12, 64, 14, 64, 991, 11, 64, 7,
+    64, 993, 10, 64, 12, 64, 14, 64, 996, 11, 64, 3, 65, 3, 65, 3, 66, 3, 66, 3, 66, 3, 66, 3, 66, 3, 66, 3, 66, 3,
+    66, 3, 66, 3, 66, 5, 66, 1010, 10, 66, 3, 67, 3, 67, 5, 67, 1014, 10, 67, 3, 67, 3, 67, 3, 67, 3, 67, 3, 67, 5,
+    67, 1021, 10, 67, 3, 67, 7, 67, 1024, 10, 67, 12, 67, 14, 67, 1027, 11, 67, 3, 68, 3, 68, 3, 68, 3, 69, 3, 69, 3,
+    69, 3, 69, 3, 69, 7, 69, 1037, 10, 69, 12, 69, 14, 69, 1040, 11, 69, 3, 70, 3, 70, 3, 70, 3, 70, 3, 70, 3, 70, 5,
+    70, 1048, 10, 70, 3, 71, 3, 71, 3, 71, 3, 71, 3, 71, 6, 71, 1055, 10, 71, 13, 71, 14, 71, 1056, 3, 71, 3, 71, 3,
+    71, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 3, 72, 7, 72, 1074, 10, 72, 12,
+    72, 14, 72, 1077, 11, 72, 5, 72, 1079, 10, 72, 3, 72, 3, 72, 3, 72, 3, 72, 7, 72, 1085, 10, 72, 12, 72, 14, 72,
+    1088, 11, 72, 5, 72, 1090, 10, 72, 7, 72, 1092, 10, 72, 12, 72, 14, 72, 1095, 11, 72, 3, 72, 3, 72, 5, 72, 1099,
+    10, 72, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 3, 73, 5, 73, 1112, 10, 73, 3, 74,
+    3, 74, 5, 74, 1116, 10, 74, 3, 74, 3, 74, 3, 75, 3, 75, 3, 75, 3, 75, 3, 75, 7, 75, 1125, 10, 75, 12, 75, 14, 75,
+    1128, 11, 75, 3, 76, 3, 76, 5, 76, 1132, 10, 76, 3, 77, 5, 77, 1135, 10, 77, 3, 77, 3, 77, 3, 78, 3, 78, 3, 78,
+    3, 78, 3, 78, 3, 78, 3, 78, 5, 78, 1146, 10, 78, 3, 78, 3, 78, 3, 78, 3, 78, 3, 78, 3, 78, 5, 78, 1154, 10, 78,
+    3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79, 3, 79,
+    3, 79, 5, 79, 1173, 10, 79, 3, 79, 3, 79, 5, 79, 1177, 10, 79, 3, 79, 3, 79, 5, 79, 1181, 10, 79, 3, 79, 3, 79,
+    3, 79, 3, 79, 3, 79, 3, 79, 5, 79, 1189, 10, 79, 3, 79, 3, 79, 5, 79, 1193, 10, 79, 3, 79, 3, 79, 3, 79, 5, 79,
+    1198, 10, 79, 3, 80, 3, 80, 3, 80, 3, 80, 3, 80, 3, 80, 3, 80, 3, 80, 3, 80, 5, 80, 1209, 10, 80, 3, 80, 3, 80,
+    3, 80, 3, 80, 3, 80, 5, 80, 1216, 10, 80, 3, 81, 5, 81, 1219, 10, 81, 3, 81, 3, 81, 3, 82, 3, 82, 3, 82, 3, 82,
+    3, 82, 7, 82, 1228, 10, 82, 12, 82, 14, 82, 1231, 11, 82, 3, 83, 3, 83, 3, 83, 5, 83, 1236, 10, 83, 3, 84, 5, 84,
+    1239, 10, 84, 3, 84, 3, 84, 5, 84, 1243, 10, 84, 3, 84, 3, 84, 3, 85, 3, 85, 3, 85, 3, 85, 3, 85, 7, 85, 1252,
+    10, 85, 12, 85, 14, 85, 1255, 11, 85, 3, 85, 2, 30, 6, 10, 12, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 46, 58,
+    70, 76, 82, 98, 112, 116, 120, 126, 132, 136, 148, 162, 168, 86, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26,
+    28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82,
+    84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 128, 130,
+    132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 2, 14, 7, 2, 73,
+    73, 75, 75, 77, 77, 80, 80, 85, 86, 3, 2, 91, 101, 8, 2, 17, 17, 28, 28, 36, 36, 42, 42, 45, 45, 60, 60, 10, 2,
+    6, 8, 20, 20, 25, 25, 29, 29, 34, 35, 39, 40, 47, 48, 54, 55, 3, 2, 6, 8, 4, 2, 43, 43, 46, 46, 6, 2, 21, 21, 37,
+    37, 49, 49, 53, 53, 5, 2, 10, 11, 33, 33, 58, 58, 4, 2, 61, 62, 90, 90, 3, 2, 61, 62, 4, 2, 13, 13, 15, 15, 4, 2,
+    16, 16, 49, 49, 1369, 2, 203, 3, 2, 2, 2, 4, 205, 3, 2, 2, 2, 6, 212, 3, 2, 2, 2, 8, 230, 3, 2, 2, 2, 10, 266, 3,
+    2, 2, 2, 12, 294, 3, 2, 2, 2, 14, 327, 3, 2, 2, 2, 16, 329, 3, 2, 2, 2, 18, 343, 3, 2, 2, 2, 20, 345, 3, 2, 2, 2,
+    22, 362, 3, 2, 2, 2, 24, 376, 3, 2, 2, 2, 26, 390, 3, 2, 2, 2, 28, 410, 3, 2, 2, 2, 30, 424, 3, 2, 2, 2, 32, 435,
+    3, 2, 2, 2, 34, 446, 3, 2, 2, 2, 36, 457, 3, 2, 2, 2, 38, 468, 3, 2, 2, 2, 40, 479, 3, 2, 2, 2, 42, 492, 3, 2, 2,
+    2, 44, 494, 3, 2, 2, 2, 46, 496, 3, 2, 2, 2, 48, 507, 3, 2, 2, 2, 50, 516, 3, 2, 2, 2, 52, 519, 3, 2, 2, 2, 54,
+    524, 3, 2, 2, 2, 56, 533, 3, 2, 2, 2, 58, 535, 3, 2, 2, 2, 60, 551, 3, 2, 2, 2, 62, 553, 3, 2, 2, 2, 64, 569, 3,
+    2, 2, 2, 66, 582, 3, 2, 2, 2, 68, 584, 3, 2, 2, 2, 70, 586, 3, 2, 2, 2, 72, 603, 3, 2, 2, 2, 74, 613, 3, 2, 2, 2,
+    76, 615, 3, 2, 2, 2, 78, 632, 3, 2, 2, 2, 80, 653, 3, 2, 2, 2, 82, 655, 3, 2, 2, 2, 84, 671, 3, 2, 2, 2, 86, 673,
+    3, 2, 2, 2, 88, 675, 3, 2, 2, 2, 90, 680, 3, 2, 2, 2, 92, 688, 3, 2, 2, 2, 94, 700, 3, 2, 2, 2, 96, 703, 3, 2, 2,
+    2, 98, 718, 3, 2, 2, 2, 100, 777, 3, 2, 2, 2, 102, 779, 3, 2, 2, 2, 104, 795, 3, 2, 2, 2, 106, 806, 3, 2, 2, 2,
+    108, 815, 3, 2, 2, 2, 110, 836, 3, 2, 2, 2, 112, 838, 3, 2, 2, 2, 114, 853, 3, 2, 2, 2, 116, 855, 3, 2, 2, 2,
+    118, 873, 3, 2, 2, 2, 120, 875, 3, 2, 2, 2, 122, 886, 3, 2, 2, 2, 124, 901, 3, 2, 2, 2, 126, 949, 3, 2, 2, 2,
+    128, 997, 3, 2, 2, 2, 130, 1009, 3, 2, 2, 2, 132, 1011, 3, 2, 2, 2, 134, 1028, 3, 2, 2, 2, 136, 1031, 3, 2, 2, 2,
+    138, 1047, 3, 2, 2, 2, 140, 1049, 3, 2, 2, 2, 142, 1098, 3, 2, 2, 2, 144, 1111, 3, 2, 2, 2, 146, 1113, 3, 2, 2,
+    2, 148, 1119, 3, 2, 2, 2, 150, 1131, 3, 2, 2, 2, 152, 1134, 3, 2, 2, 2, 154, 1153, 3, 2, 2, 2, 156, 1197, 3, 2,
+    2, 2, 158, 1215, 3, 2, 2, 2, 160, 1218, 3, 2, 2, 2, 162, 1222, 3, 2, 2, 2, 164, 1235, 3, 2, 2, 2, 166, 1238, 3,
+    2, 2, 2, 168, 1246, 3, 2, 2, 2, 170, 204, 7, 107, 2, 2, 171, 204, 7, 108, 2, 2, 172, 174, 7, 109, 2, 2, 173, 172,
+    3, 2, 2, 2, 174, 175, 3, 2, 2, 2, 175, 173, 3, 2, 2, 2, 175, 176, 3, 2, 2, 2, 176, 204, 3, 2, 2, 2, 177, 178, 7,
+    61, 2, 2, 178, 179, 5, 46, 24, 2, 179, 180, 7, 62, 2, 2, 180, 204, 3, 2, 2, 2, 181, 204, 5, 4, 3, 2, 182, 184, 7,
+    3, 2, 2, 183, 182, 3, 2, 2, 2, 183, 184, 3, 2, 2, 2, 184, 185, 3, 2, 2, 2, 185, 186, 7, 61, 2, 2, 186, 187, 5,
+    146, 74, 2, 187, 188, 7, 62, 2, 2, 188, 204, 3, 2, 2, 2, 189, 190, 7, 4, 2, 2, 190, 191, 7, 61, 2, 2, 191, 192,
+    5, 14, 8, 2, 192, 193, 7, 90, 2, 2, 193, 194, 5, 122, 62, 2, 194, 195, 7, 62, 2, 2, 195, 204, 3, 2, 2, 2, 196,
+    197, 7, 5, 2, 2, 197, 198, 7, 61, 2, 2, 198, 199, 5, 122, 62, 2, 199, 200, 7, 90, 2, 2, 200, 201, 5, 14, 8, 2,
+    201, 202, 7, 62, 2, 2, 202, 204, 3, 2, 2, 2, 203, 170, 3, 2, 2, 2, 203, 171, 3, 2, 2, 2, 203, 173, 3, 2, 2, 2,
+    203, 177, 3, 2, 2, 2, 203, 181, 3, 2, 2, 2, 203, 183, 3, 2, 2, 2, 203, 189, 3, 2, 2, 2, 203, 196, 3, 2, 2, 2,
+    204, 3, 3, 2, 2, 2, 205, 206, 7, 56, 2, 2, 206, 207, 7, 61, 2, 2, 207, 208, 5, 42, 22, 2, 208, 209, 7, 90, 2, 2,
+    209, 210, 5, 6, 4, 2, 210, 211, 7, 62, 2, 2, 211, 5, 3, 2, 2, 2, 212, 213, 8, 4, 1, 2, 213, 214, 5, 8, 5, 2, 214,
+    220, 3, 2, 2, 2, 215, 216, 12, 3, 2, 2, 216, 217, 7, 90, 2, 2, 217, 219, 5, 8, 5, 2, 218, 215, 3, 2, 2, 2, 219,
+    222, 3, 2, 2, 2, 220, 218, 3, 2, 2, 2, 220, 221, 3, 2, 2, 2, 221, 7, 3, 2, 2, 2, 222, 220, 3, 2, 2, 2, 223, 224,
+    5, 122, 62, 2, 224, 225, 7, 88, 2, 2, 225, 226, 5, 42, 22, 2, 226, 231, 3, 2, 2, 2, 227, 228, 7, 23, 2, 2, 228,
+    229, 7, 88, 2, 2, 229, 231, 5, 42, 22, 2, 230, 223, 3, 2, 2, 2, 230, 227, 3, 2, 2, 2, 231, 9, 3, 2, 2, 2, 232,
+    233, 8, 6, 1, 2, 233, 267, 5, 2, 2, 2, 234, 235, 7, 61, 2, 2, 235, 236, 5, 122, 62, 2, 236, 237, 7, 62, 2, 2,
+    237, 238, 7, 65, 2, 2, 238, 239, 5, 132, 67, 2, 239, 240, 7, 66, 2, 2, 240, 267, 3, 2, 2, 2, 241, 242, 7, 61, 2,
+    2, 242, 243, 5, 122, 62, 2, 243, 244, 7, 62, 2, 2, 244, 245, 7, 65, 2, 2, 245, 246, 5, 132, 67, 2, 246, 247, 7,
+    90, 2, 2, 247, 248, 7, 66, 2, 2, 248, 267, 3, 2, 2, 2, 249, 250, 7, 3, 2, 2, 250, 251, 7, 61, 2, 2, 251, 252, 5,
+    122, 62, 2, 252, 253, 7, 62, 2, 2, 253, 254, 7, 65, 2, 2, 254, 255, 5, 132, 67, 2, 255, 256, 7, 66, 2, 2, 256,
+    267, 3, 2, 2, 2, 257, 258, 7, 3, 2, 2, 258, 259, 7, 61, 2, 2, 259, 260, 5, 122, 62, 2, 260, 261, 7, 62, 2, 2,
+    261, 262, 7, 65, 2, 2, 262, 263, 5, 132, 67, 2, 263, 264, 7, 90, 2, 2, 264, 265, 7, 66, 2, 2, 265, 267, 3, 2, 2,
+    2, 266, 232, 3, 2, 2, 2, 266, 234, 3, 2, 2, 2, 266, 241, 3, 2, 2, 2, 266, 249, 3, 2, 2, 2, 266, 257, 3, 2, 2, 2,
+    267, 291, 3, 2, 2, 2, 268, 269, 12, 12, 2, 2, 269, 270, 7, 63, 2, 2, 270, 271, 5, 46, 24, 2, 271, 272, 7, 64, 2,
+    2, 272, 290, 3, 2, 2, 2, 273, 274, 12, 11, 2, 2, 274, 276, 7, 61, 2, 2, 275, 277, 5, 12, 7, 2, 276, 275, 3, 2, 2,
+    2, 276, 277, 3, 2, 2, 2, 277, 278, 3, 2, 2, 2, 278, 290, 7, 62, 2, 2, 279, 280, 12, 10, 2, 2, 280, 281, 7, 105,
+    2, 2, 281, 290, 7, 107, 2, 2, 282, 283, 12, 9, 2, 2, 283, 284, 7, 104, 2, 2, 284, 290, 7, 107, 2, 2, 285, 286,
+    12, 8, 2, 2, 286, 290, 7, 74, 2, 2, 287, 288, 12, 7, 2, 2, 288, 290, 7, 76, 2, 2, 289, 268, 3, 2, 2, 2, 289, 273,
+    3, 2, 2, 2, 289, 279, 3, 2, 2, 2, 289, 282, 3, 2, 2, 2, 289, 285, 3, 2, 2, 2, 289, 287, 3, 2, 2, 2, 290, 293, 3,
+    2, 2, 2, 291, 289, 3, 2, 2, 2, 291, 292, 3, 2, 2, 2, 292, 11, 3, 2, 2, 2, 293, 291, 3, 2, 2, 2, 294, 295, 8, 7,
+    1, 2, 295, 296, 5, 42, 22, 2, 296, 302, 3, 2, 2, 2, 297, 298, 12, 3, 2, 2, 298, 299, 7, 90, 2, 2, 299, 301, 5,
+    42, 22, 2, 300, 297, 3, 2, 2, 2, 301, 304, 3, 2, 2, 2, 302, 300, 3, 2, 2, 2, 302, 303, 3, 2, 2, 2, 303, 13, 3, 2,
+    2, 2, 304, 302, 3, 2, 2, 2, 305, 328, 5, 10, 6, 2, 306, 307, 7, 74, 2, 2, 307, 328, 5, 14, 8, 2, 308, 309, 7, 76,
+    2, 2, 309, 328, 5, 14, 8, 2, 310, 311, 5, 16, 9, 2, 311, 312, 5, 18, 10, 2, 312, 328, 3, 2, 2, 2, 313, 314, 7,
+    41, 2, 2, 314, 328, 5, 14, 8, 2, 315, 316, 7, 41, 2, 2, 316, 317, 7, 61, 2, 2, 317, 318, 5, 122, 62, 2, 318, 319,
+    7, 62, 2, 2, 319, 328, 3, 2, 2, 2, 320, 321, 7, 52, 2, 2, 321, 322, 7, 61, 2, 2, 322, 323, 5, 122, 62, 2, 323,
+    324, 7, 62, 2, 2, 324, 328, 3, 2, 2, 2, 325, 326, 7, 82, 2, 2, 326, 328, 7, 107, 2, 2, 327, 305, 3, 2, 2, 2, 327,
+    306, 3, 2, 2, 2, 327, 308, 3, 2, 2, 2, 327, 310, 3, 2, 2, 2, 327, 313, 3, 2, 2, 2, 327, 315, 3, 2, 2, 2, 327,
+    320, 3, 2, 2, 2, 327, 325, 3, 2, 2, 2, 328, 15, 3, 2, 2, 2, 329, 330, 9, 2, 2, 2, 330, 17, 3, 2, 2, 2, 331, 344,
+    5, 14, 8, 2, 332, 333, 7, 61, 2, 2, 333, 334, 5, 122, 62, 2, 334, 335, 7, 62, 2, 2, 335, 336, 5, 18, 10, 2, 336,
+    344, 3, 2, 2, 2, 337, 338, 7, 3, 2, 2, 338, 339, 7, 61, 2, 2, 339, 340, 5, 122, 62, 2, 340, 341, 7, 62, 2, 2,
+    341, 342, 5, 18, 10, 2, 342, 344, 3, 2, 2, 2, 343, 331, 3, 2, 2, 2, 343, 332, 3, 2, 2, 2, 343, 337, 3, 2, 2, 2,
+    344, 19, 3, 2, 2, 2, 345, 346, 8, 11, 1, 2, 346, 347, 5, 18, 10, 2, 347, 359, 3, 2, 2, 2, 348, 349, 12, 5, 2, 2,
+    349, 350, 7, 77, 2, 2, 350, 358, 5, 18, 10, 2, 351, 352, 12, 4, 2, 2, 352, 353, 7, 78, 2, 2, 353, 358, 5, 18, 10,
+    2, 354, 355, 12, 3, 2, 2, 355, 356, 7, 79, 2, 2, 356, 358, 5, 18, 10, 2, 357, 348, 3, 2, 2, 2, 357, 351, 3, 2, 2,
+    2, 357, 354, 3, 2, 2, 2, 358, 361, 3, 2, 2, 2, 359, 357, 3, 2, 2, 2, 359, 360, 3, 2, 2, 2, 360, 21, 3, 2, 2, 2,
+    361, 359, 3, 2, 2, 2, 362, 363, 8, 12, 1, 2, 363, 364, 5, 20, 11, 2, 364, 373, 3, 2, 2, 2, 365, 366, 12, 4, 2, 2,
+    366, 367, 7, 73, 2, 2, 367, 372, 5, 20, 11, 2, 368, 369, 12, 3, 2, 2, 369, 370, 7, 75, 2, 2, 370, 372, 5, 20, 11,
+    2, 371, 365, 3, 2, 2, 2, 371, 368, 3, 2, 2, 2, 372, 375, 3, 2, 2, 2, 373, 371, 3, 2, 2, 2, 373, 374, 3, 2, 2, 2,
+    374, 23, 3, 2, 2, 2, 375, 373, 3, 2, 2, 2, 376, 377, 8, 13, 1, 2, 377, 378, 5, 22, 12, 2, 378, 387, 3, 2, 2, 2,
+    379, 380, 12, 4, 2, 2, 380, 381, 7, 71, 2, 2, 381, 386, 5, 22, 12, 2, 382, 383, 12, 3, 2, 2, 383, 384, 7, 72, 2,
+    2, 384, 386, 5, 22, 12, 2, 385, 379, 3, 2, 2, 2, 385, 382, 3, 2, 2, 2, 386, 389, 3, 2, 2, 2, 387, 385, 3, 2, 2,
+    2, 387, 388, 3, 2, 2, 2, 388, 25, 3, 2, 2, 2, 389, 387, 3, 2, 2, 2, 390, 391, 8, 14, 1, 2, 391, 392, 5, 24, 13,
+    2, 392, 407, 3, 2, 2, 2, 393, 394, 12, 6, 2, 2, 394, 395, 7, 67, 2, 2, 395, 406, 5, 24, 13, 2, 396, 397, 12, 5,
+    2, 2, 397, 398, 7, 69, 2, 2, 398, 406, 5, 24, 13, 2, 399, 400, 12, 4, 2, 2, 400, 401, 7, 68, 2, 2, 401, 406, 5,
+    24, 13, 2, 402, 403, 12, 3, 2, 2, 403, 404, 7, 70, 2, 2, 404, 406, 5, 24, 13, 2, 405, 393, 3, 2, 2, 2, 405, 396,
+    3, 2, 2, 2, 405, 399, 3, 2, 2, 2, 405, 402, 3, 2, 2, 2, 406, 409, 3, 2, 2, 2, 407, 405, 3, 2, 2, 2, 407, 408, 3,
+    2, 2, 2, 408, 27, 3, 2, 2, 2, 409, 407, 3, 2, 2, 2, 410, 411, 8, 15, 1, 2, 411, 412, 5, 26, 14, 2, 412, 421, 3,
+    2, 2, 2, 413, 414, 12, 4, 2, 2, 414, 415, 7, 102, 2, 2, 415, 420, 5, 26, 14, 2, 416, 417, 12, 3, 2, 2, 417, 418,
+    7, 103, 2, 2, 418, 420, 5, 26, 14, 2, 419, 413, 3, 2, 2, 2, 419, 416, 3, 2, 2, 2, 420, 423, 3, 2, 2, 2, 421, 419,
+    3, 2, 2, 2, 421, 422, 3, 2, 2, 2, 422, 29, 3, 2, 2, 2, 423, 421, 3, 2, 2, 2, 424, 425, 8, 16, 1, 2, 425, 426, 5,
+    28, 15, 2, 426, 432, 3, 2, 2, 2, 427, 428, 12, 3, 2, 2, 428, 429, 7, 80, 2, 2, 429, 431, 5, 28, 15, 2, 430, 427,
+    3, 2, 2, 2, 431, 434, 3, 2, 2, 2, 432, 430, 3, 2, 2, 2, 432, 433, 3, 2, 2, 2, 433, 31, 3, 2, 2, 2, 434, 432, 3,
+    2, 2, 2, 435, 436, 8, 17, 1, 2, 436, 437, 5, 30, 16, 2, 437, 443, 3, 2, 2, 2, 438, 439, 12, 3, 2, 2, 439, 440, 7,
+    84, 2, 2, 440, 442, 5, 30, 16, 2, 441, 438, 3, 2, 2, 2, 442, 445, 3, 2, 2, 2, 443, 441, 3, 2, 2, 2, 443, 444, 3,
+    2, 2, 2, 444, 33, 3, 2, 2, 2, 445, 443, 3, 2, 2, 2, 446, 447, 8, 18, 1, 2, 447, 448, 5, 32, 17, 2, 448, 454, 3,
+    2, 2, 2, 449, 450, 12, 3, 2, 2, 450, 451, 7, 81, 2, 2, 451, 453, 5, 32, 17, 2, 452, 449, 3, 2, 2, 2, 453, 456, 3,
+    2, 2, 2, 454, 452, 3, 2, 2, 2, 454, 455, 3, 2, 2, 2, 455, 35, 3, 2, 2, 2, 456, 454, 3, 2, 2, 2, 457, 458, 8, 19,
+    1, 2, 458, 459, 5, 34, 18, 2, 459, 465, 3, 2, 2, 2, 460, 461, 12, 3, 2, 2, 461, 462, 7, 82, 2, 2, 462, 464, 5,
+    34, 18, 2, 463, 460, 3, 2, 2, 2, 464, 467, 3, 2, 2, 2, 465, 463, 3, 2, 2, 2, 465, 466, 3, 2, 2, 2, 466, 37, 3, 2,
+    2, 2, 467, 465, 3, 2, 2, 2, 468, 469, 8, 20, 1, 2, 469, 470, 5, 36, 19, 2, 470, 476, 3, 2, 2, 2, 471, 472, 12, 3,
+    2, 2, 472, 473, 7, 83, 2, 2, 473, 475, 5, 36, 19, 2, 474, 471, 3, 2, 2, 2, 475, 478, 3, 2, 2, 2, 476, 474, 3, 2,
+    2, 2, 476, 477, 3, 2, 2, 2, 477, 39, 3, 2, 2, 2, 478, 476, 3, 2, 2, 2, 479, 485, 5, 38, 20, 2, 480, 481, 7, 87,
+    2, 2, 481, 482, 5, 46, 24, 2, 482, 483, 7, 88, 2, 2, 483, 484, 5, 40, 21, 2, 484, 486, 3, 2, 2, 2, 485, 480, 3,
+    2, 2, 2, 485, 486, 3, 2, 2, 2, 486, 41, 3, 2, 2, 2, 487, 493, 5, 40, 21, 2, 488, 489, 5, 14, 8, 2, 489, 490, 5,
+    44, 23, 2, 490, 491, 5, 42, 22, 2, 491, 493, 3, 2, 2, 2, 492, 487, 3, 2, 2, 2, 492, 488, 3, 2, 2, 2, 493, 43, 3,
+    2, 2, 2, 494, 495, 9, 3, 2, 2, 495, 45, 3, 2, 2, 2, 496, 497, 8, 24, 1, 2, 497, 498, 5, 42, 22, 2, 498, 504, 3,
+    2, 2, 2, 499, 500, 12, 3, 2, 2, 500, 501, 7, 90, 2, 2, 501, 503, 5, 42, 22, 2, 502, 499, 3, 2, 2, 2, 503, 506, 3,
+    2, 2, 2, 504, 502, 3, 2, 2, 2, 504, 505, 3, 2, 2, 2, 505, 47, 3, 2, 2, 2, 506, 504, 3, 2, 2, 2, 507, 508, 5, 40,
+    21, 2, 508, 49, 3, 2, 2, 2, 509, 511, 5, 52, 27, 2, 510, 512, 5, 58, 30, 2, 511, 510, 3, 2, 2, 2, 511, 512, 3, 2,
+    2, 2, 512, 513, 3, 2, 2, 2, 513, 514, 7, 89, 2, 2, 514, 517, 3, 2, 2, 2, 515, 517, 5, 140, 71, 2, 516, 509, 3, 2,
+    2, 2, 516, 515, 3, 2, 2, 2, 517, 51, 3, 2, 2, 2, 518, 520, 5, 56, 29, 2, 519, 518, 3, 2, 2, 2, 520, 521, 3, 2, 2,
+    2, 521, 519, 3, 2, 2, 2, 521, 522, 3, 2, 2, 2, 522, 53, 3, 2, 2, 2, 523, 525, 5, 56, 29, 2, 524, 523, 3, 2, 2, 2,
+    525, 526, 3, 2, 2, 2, 526, 524, 3, 2, 2, 2, 526, 527, 3, 2, 2, 2, 527, 55, 3, 2, 2, 2, 528, 534, 5, 62, 32, 2,
+    529, 534, 5, 64, 33, 2, 530, 534, 5, 90, 46, 2, 531, 534, 5, 92, 47, 2, 532, 534, 5, 94, 48, 2, 533, 528, 3, 2,
+    2, 2, 533, 529, 3, 2, 2, 2, 533, 530, 3, 2, 2, 2, 533, 531, 3, 2, 2, 2, 533, 532, 3, 2, 2, 2, 534, 57, 3, 2, 2,
+    2, 535, 536, 8, 30, 1, 2, 536, 537, 5, 60, 31, 2, 537, 543, 3, 2, 2, 2, 538, 539, 12, 3, 2, 2, 539, 540, 7, 90,
+    2, 2, 540, 542, 5, 60, 31, 2, 541, 538, 3, 2, 2, 2, 542, 545, 3, 2, 2, 2, 543, 541, 3, 2, 2, 2, 543, 544, 3, 2,
+    2, 2, 544, 59, 3, 2, 2, 2, 545, 543, 3, 2, 2, 2, 546, 552, 5, 96, 49, 2, 547, 548, 5, 96, 49, 2, 548, 549, 7, 91,
+    2, 2, 549, 550, 5, 130, 66, 2, 550, 552, 3, 2, 2, 2, 551, 546, 3, 2, 2, 2, 551, 547, 3, 2, 2, 2, 552, 61, 3, 2,
+    2, 2, 553, 554, 9, 4, 2, 2, 554, 63, 3, 2, 2, 2, 555, 570, 9, 5, 2, 2, 556, 557, 7, 3, 2, 2, 557, 558, 7, 61, 2,
+    2, 558, 559, 9, 6, 2, 2, 559, 570, 7, 62, 2, 2, 560, 570, 5, 88, 45, 2, 561, 570, 5, 66, 34, 2, 562, 570, 5, 80,
+    41, 2, 563, 570, 5, 128, 65, 2, 564, 565, 7, 9, 2, 2, 565, 566, 7, 61, 2, 2, 566, 567, 5, 48, 25, 2, 567, 568, 7,
+    62, 2, 2, 568, 570, 3, 2, 2, 2, 569, 555, 3, 2, 2, 2, 569, 556, 3, 2, 2, 2, 569, 560, 3, 2, 2, 2, 569, 561, 3, 2,
+    2, 2, 569, 562, 3, 2, 2, 2, 569, 563, 3, 2, 2, 2, 569, 564, 3, 2, 2, 2, 570, 65, 3, 2, 2, 2, 571, 573, 5, 68, 35,
+    2, 572, 574, 7, 107, 2, 2, 573, 572, 3, 2, 2, 2, 573, 574, 3, 2, 2, 2, 574, 575, 3, 2, 2, 2, 575, 576, 7, 65, 2,
+    2, 576, 577, 5, 70, 36, 2, 577, 578, 7, 66, 2, 2, 578, 583, 3, 2, 2, 2, 579, 580, 5, 68, 35, 2, 580, 581, 7, 107,
+    2, 2, 581, 583, 3, 2, 2, 2, 582, 571, 3, 2, 2, 2, 582, 579, 3, 2, 2, 2, 583, 67, 3, 2, 2, 2, 584, 585, 9, 7, 2,
+    2, 585, 69, 3, 2, 2, 2, 586, 587, 8, 36, 1, 2, 587, 588, 5, 72, 37, 2, 588, 593, 3, 2, 2, 2, 589, 590, 12, 3, 2,
+    2, 590, 592, 5, 72, 37, 2, 591, 589, 3, 2, 2, 2, 592, 595, 3, 2, 2, 2, 593, 591, 3, 2, 2, 2, 593, 594, 3, 2, 2,
+    2, 594, 71, 3, 2, 2, 2, 595, 593, 3, 2, 2, 2, 596, 598, 5, 74, 38, 2, 597, 599, 5, 76, 39, 2, 598, 597, 3, 2, 2,
+    2, 598, 599, 3, 2, 2, 2, 599, 600, 3, 2, 2, 2, 600, 601, 7, 89, 2, 2, 601, 604, 3, 2, 2, 2, 602, 604, 5, 140, 71,
+    2, 603, 596, 3, 2, 2, 2, 603, 602, 3, 2, 2, 2, 604, 73, 3, 2, 2, 2, 605, 607, 5, 64, 33, 2, 606, 608, 5, 74, 38,
+    2, 607, 606, 3, 2, 2, 2, 607, 608, 3, 2, 2, 2, 608, 614, 3, 2, 2, 2, 609, 611, 5, 90, 46, 2, 610, 612, 5, 74, 38,
+    2, 611, 610, 3, 2, 2, 2, 611, 612, 3, 2, 2, 2, 612, 614, 3, 2, 2, 2, 613, 605, 3, 2, 2, 2, 613, 609, 3, 2, 2, 2,
+    614, 75, 3, 2, 2, 2, 615, 616, 8, 39, 1, 2, 616, 617, 5, 78, 40, 2, 617, 623, 3, 2, 2, 2, 618, 619, 12, 3, 2, 2,
+    619, 620, 7, 90, 2, 2, 620, 622, 5, 78, 40, 2, 621, 618, 3, 2, 2, 2, 622, 625, 3, 2, 2, 2, 623, 621, 3, 2, 2, 2,
+    623, 624, 3, 2, 2, 2, 624, 77, 3, 2, 2, 2, 625, 623, 3, 2, 2, 2, 626, 633, 5, 96, 49, 2, 627, 629, 5, 96, 49, 2,
+    628, 627, 3, 2, 2, 2, 628, 629, 3, 2, 2, 2, 629, 630, 3, 2, 2, 2, 630, 631, 7, 88, 2, 2, 631, 633, 5, 48, 25, 2,
+    632, 626, 3, 2, 2, 2, 632, 628, 3, 2, 2, 2, 633, 79, 3, 2, 2, 2, 634, 636, 7, 27, 2, 2, 635, 637, 7, 107, 2, 2,
+    636, 635, 3, 2, 2, 2, 636, 637, 3, 2, 2, 2, 637, 638, 3, 2, 2, 2, 638, 639, 7, 65, 2, 2, 639, 640, 5, 82, 42, 2,
+    640, 641, 7, 66, 2, 2, 641, 654, 3, 2, 2, 2, 642, 644, 7, 27, 2, 2, 643, 645, 7, 107, 2, 2, 644, 643, 3, 2, 2, 2,
+    644, 645, 3, 2, 2, 2, 645, 646, 3, 2, 2, 2, 646, 647, 7, 65, 2, 2, 647, 648, 5, 82, 42, 2, 648, 649, 7, 90, 2, 2,
+    649, 650, 7, 66, 2, 2, 650, 654, 3, 2, 2, 2, 651, 652, 7, 27, 2, 2, 652, 654, 7, 107, 2, 2, 653, 634, 3, 2, 2, 2,
+    653, 642, 3, 2, 2, 2, 653, 651, 3, 2, 2, 2, 654, 81, 3, 2, 2, 2, 655, 656, 8, 42, 1, 2, 656, 657, 5, 84, 43, 2,
+    657, 663, 3, 2, 2, 2, 658, 659, 12, 3, 2, 2, 659, 660, 7, 90, 2, 2, 660, 662, 5, 84, 43, 2, 661, 658, 3, 2, 2, 2,
+    662, 665, 3, 2, 2, 2, 663, 661, 3, 2, 2, 2, 663, 664, 3, 2, 2, 2, 664, 83, 3, 2, 2, 2, 665, 663, 3, 2, 2, 2, 666,
+    672, 5, 86, 44, 2, 667, 668, 5, 86, 44, 2, 668, 669, 7, 91, 2, 2, 669, 670, 5, 48, 25, 2, 670, 672, 3, 2, 2, 2,
+    671, 666, 3, 2, 2, 2, 671, 667, 3, 2, 2, 2, 672, 85, 3, 2, 2, 2, 673, 674, 7, 107, 2, 2, 674, 87, 3, 2, 2, 2,
+    675, 676, 7, 53, 2, 2, 676, 677, 7, 61, 2, 2, 677, 678, 5, 122, 62, 2, 678, 679, 7, 62, 2, 2, 679, 89, 3, 2, 2,
+    2, 680, 681, 9, 8, 2, 2, 681, 91, 3, 2, 2, 2, 682, 689, 9, 9, 2, 2, 683, 689, 5, 102, 52, 2, 684, 685, 7, 12, 2,
+    2, 685, 686, 7, 61, 2, 2, 686, 687, 7, 107, 2, 2, 687, 689, 7, 62, 2, 2, 688, 682, 3, 2, 2, 2, 688, 683, 3, 2, 2,
+    2, 688, 684, 3, 2, 2, 2, 689, 93, 3, 2, 2, 2, 690, 691, 7, 51, 2, 2, 691, 692, 7, 61, 2, 2, 692, 693, 5, 122, 62,
+    2, 693, 694, 7, 62, 2, 2, 694, 701, 3, 2, 2, 2, 695, 696, 7, 51, 2, 2, 696, 697, 7, 61, 2, 2, 697, 698, 5, 48,
+    25, 2, 698, 699, 7, 62, 2, 2, 699, 701, 3, 2, 2, 2, 700, 690, 3, 2, 2, 2, 700, 695, 3, 2, 2, 2, 701, 95, 3, 2, 2,
+    2, 702, 704, 5, 110, 56, 2, 703, 702, 3, 2, 2, 2, 703, 704, 3, 2, 2, 2, 704, 705, 3, 2, 2, 2, 705, 709, 5, 98,
+    50, 2, 706, 708, 5, 100, 51, 2, 707, 706, 3, 2, 2, 2, 708, 711, 3, 2, 2, 2, 709, 707, 3, 2, 2, 2, 709, 710, 3, 2,
+    2, 2, 710, 97, 3, 2, 2, 2, 711, 709, 3, 2, 2, 2, 712, 713, 8, 50, 1, 2, 713, 719, 7, 107, 2, 2, 714, 715, 7, 61,
+    2, 2, 715, 716, 5, 96, 49, 2, 716, 717, 7, 62, 2, 2, 717, 719, 3, 2, 2, 2, 718, 712, 3, 2, 2, 2, 718, 714, 3, 2,
+    2, 2, 719, 765, 3, 2, 2, 2, 720, 721, 12, 8, 2, 2, 721, 723, 7, 63, 2, 2, 722, 724, 5, 112, 57, 2, 723, 722, 3,
+    2, 2, 2, 723, 724, 3, 2, 2, 2, 724, 726, 3, 2, 2, 2, 725, 727, 5, 42, 22, 2, 726, 725, 3, 2, 2, 2, 726, 727, 3,
+    2, 2, 2, 727, 728, 3, 2, 2, 2, 728, 764, 7, 64, 2, 2, 729, 730, 12, 7, 2, 2, 730, 731, 7, 63, 2, 2, 731, 733, 7,
+    42, 2, 2, 732, 734, 5, 112, 57, 2, 733, 732, 3, 2, 2, 2, 733, 734, 3, 2, 2, 2, 734, 735, 3, 2, 2, 2, 735, 736, 5,
+    42, 22, 2, 736, 737, 7, 64, 2, 2, 737, 764, 3, 2, 2, 2, 738, 739, 12, 6, 2, 2, 739, 740, 7, 63, 2, 2, 740, 741,
+    5, 112, 57, 2, 741, 742, 7, 42, 2, 2, 742, 743, 5, 42, 22, 2, 743, 744, 7, 64, 2, 2, 744, 764, 3, 2, 2, 2, 745,
+    746, 12, 5, 2, 2, 746, 748, 7, 63, 2, 2, 747, 749, 5, 112, 57, 2, 748, 747, 3, 2, 2, 2, 748, 749, 3, 2, 2, 2,
+    749, 750, 3, 2, 2, 2, 750, 751, 7, 77, 2, 2, 751, 764, 7, 64, 2, 2, 752, 753, 12, 4, 2, 2, 753, 754, 7, 61, 2, 2,
+    754, 755, 5, 114, 58, 2, 755, 756, 7, 62, 2, 2, 756, 764, 3, 2, 2, 2, 757, 758, 12, 3, 2, 2, 758, 760, 7, 61, 2,
+    2, 759, 761, 5, 120, 61, 2, 760, 759, 3, 2, 2, 2, 760, 761, 3, 2, 2, 2, 761, 762, 3, 2, 2, 2, 762, 764, 7, 62, 2,
+    2, 763, 720, 3, 2, 2, 2, 763, 729, 3, 2, 2, 2, 763, 738, 3, 2, 2, 2, 763, 745, 3, 2, 2, 2, 763, 752, 3, 2, 2, 2,
+    763, 757, 3, 2, 2, 2, 764, 767, 3, 2, 2, 2, 765, 763, 3, 2, 2, 2, 765, 766, 3, 2, 2, 2, 766, 99, 3, 2, 2, 2, 767,
+    765, 3, 2, 2, 2, 768, 769, 7, 13, 2, 2, 769, 771, 7, 61, 2, 2, 770, 772, 7, 109, 2, 2, 771, 770, 3, 2, 2, 2, 772,
+    773, 3, 2, 2, 2, 773, 771, 3, 2, 2, 2, 773, 774, 3, 2, 2, 2, 774, 775, 3, 2, 2, 2, 775, 778, 7, 62, 2, 2, 776,
+    778, 5, 102, 52, 2, 777, 768, 3, 2, 2, 2, 777, 776, 3, 2, 2, 2, 778, 101, 3, 2, 2, 2, 779, 780, 7, 14, 2, 2, 780,
+    781, 7, 61, 2, 2, 781, 782, 7, 61, 2, 2, 782, 783, 5, 104, 53, 2, 783, 784, 7, 62, 2, 2, 784, 785, 7, 62, 2, 2,
+    785, 103, 3, 2, 2, 2, 786, 791, 5, 106, 54, 2, 787, 788, 7, 90, 2, 2, 788, 790, 5, 106, 54, 2, 789, 787, 3, 2, 2,
+    2, 790, 793, 3, 2, 2, 2, 791, 789, 3, 2, 2, 2, 791, 792, 3, 2, 2, 2, 792, 796, 3, 2, 2, 2, 793, 791, 3, 2, 2, 2,
+    794, 796, 3, 2, 2, 2, 795, 786, 3, 2, 2, 2, 795, 794, 3, 2, 2, 2, 796, 105, 3, 2, 2, 2, 797, 803, 10, 10, 2, 2,
+    798, 800, 7, 61, 2, 2, 799, 801, 5, 12, 7, 2, 800, 799, 3, 2, 2, 2, 800, 801, 3, 2, 2, 2, 801, 802, 3, 2, 2, 2,
+    802, 804, 7, 62, 2, 2, 803, 798, 3, 2, 2, 2, 803, 804, 3, 2, 2, 2, 804, 807, 3, 2, 2, 2, 805, 807, 3, 2, 2, 2,
+    806, 797, 3, 2, 2, 2, 806, 805, 3, 2, 2, 2, 807, 107, 3, 2, 2, 2, 808, 814, 10, 11, 2, 2, 809, 810, 7, 61, 2, 2,
+    810, 811, 5, 108, 55, 2, 811, 812, 7, 62, 2, 2, 812, 814, 3, 2, 2, 2, 813, 808, 3, 2, 2, 2, 813, 809, 3, 2, 2, 2,
+    814, 817, 3, 2, 2, 2, 815, 813, 3, 2, 2, 2, 815, 816, 3, 2, 2, 2, 816, 109, 3, 2, 2, 2, 817, 815, 3, 2, 2, 2,
+    818, 820, 7, 77, 2, 2, 819, 821, 5, 112, 57, 2, 820, 819, 3, 2, 2, 2, 820, 821, 3, 2, 2, 2, 821, 837, 3, 2, 2, 2,
+    822, 824, 7, 77, 2, 2, 823, 825, 5, 112, 57, 2, 824, 823, 3, 2, 2, 2, 824, 825, 3, 2, 2, 2, 825, 826, 3, 2, 2, 2,
+    826, 837, 5, 110, 56, 2, 827, 829, 7, 84, 2, 2, 828, 830, 5, 112, 57, 2, 829, 828, 3, 2, 2, 2, 829, 830, 3, 2, 2,
+    2, 830, 837, 3, 2, 2, 2, 831, 833, 7, 84, 2, 2, 832, 834, 5, 112, 57, 2, 833, 832, 3, 2, 2, 2, 833, 834, 3, 2, 2,
+    2, 834, 835, 3, 2, 2, 2, 835, 837, 5, 110, 56, 2, 836, 818, 3, 2, 2, 2, 836, 822, 3, 2, 2, 2, 836, 827, 3, 2, 2,
+    2, 836, 831, 3, 2, 2, 2, 837, 111, 3, 2, 2, 2, 838, 839, 8, 57, 1, 2, 839, 840, 5, 90, 46, 2, 840, 845, 3, 2, 2,
+    2, 841, 842, 12, 3, 2, 2, 842, 844, 5, 90, 46, 2, 843, 841, 3, 2, 2, 2, 844, 847, 3, 2, 2, 2, 845, 843, 3, 2, 2,
+    2, 845, 846, 3, 2, 2, 2, 846, 113, 3, 2, 2, 2, 847, 845, 3, 2, 2, 2, 848, 854, 5, 116, 59, 2, 849, 850, 5, 116,
+    59, 2, 850, 851, 7, 90, 2, 2, 851, 852, 7, 106, 2, 2, 852, 854, 3, 2, 2, 2, 853, 848, 3, 2, 2, 2, 853, 849, 3, 2,
+    2, 2, 854, 115, 3, 2, 2, 2, 855, 856, 8, 59, 1, 2, 856, 857, 5, 118, 60, 2, 857, 863, 3, 2, 2, 2, 858, 859, 12,
+    3, 2, 2, 859, 860, 7, 90, 2, 2, 860, 862, 5, 118, 60, 2, 861, 858, 3, 2, 2, 2, 862, 865, 3, 2, 2, 2, 863, 861, 3,
+    2, 2, 2, 863, 864, 3, 2, 2, 2, 864, 117, 3, 2, 2, 2, 865, 863, 3, 2, 2, 2, 866, 867, 5, 52, 27, 2, 867, 868, 5,
+    96, 49, 2, 868, 874, 3, 2, 2, 2, 869, 871, 5, 54, 28, 2, 870, 872, 5, 124, 63, 2, 871, 870, 3, 2, 2, 2, 871, 872,
+    3, 2, 2, 2, 872, 874, 3, 2, 2, 2, 873, 866, 3, 2, 2, 2, 873, 869, 3, 2, 2, 2, 874, 119, 3, 2, 2, 2, 875, 876, 8,
+    61, 1, 2, 876, 877, 7, 107, 2, 2, 877, 883, 3, 2, 2, 2, 878, 879, 12, 3, 2, 2, 879, 880, 7, 90, 2, 2, 880, 882,
+    7, 107, 2, 2, 881, 878, 3, 2, 2, 2, 882, 885, 3, 2, 2, 2, 883, 881, 3, 2, 2, 2, 883, 884, 3, 2, 2, 2, 884, 121,
+    3, 2, 2, 2, 885, 883, 3, 2, 2, 2, 886, 888, 5, 74, 38, 2, 887, 889, 5, 124, 63, 2, 888, 887, 3, 2, 2, 2, 888,
+    889, 3, 2, 2, 2, 889, 123, 3, 2, 2, 2, 890, 902, 5, 110, 56, 2, 891, 893, 5, 110, 56, 2, 892, 891, 3, 2, 2, 2,
+    892, 893, 3, 2, 2, 2, 893, 894, 3, 2, 2, 2, 894, 898, 5, 126, 64, 2, 895, 897, 5, 100, 51, 2, 896, 895, 3, 2, 2,
+    2, 897, 900, 3, 2, 2, 2, 898, 896, 3, 2, 2, 2, 898, 899, 3, 2, 2, 2, 899, 902, 3, 2, 2, 2, 900, 898, 3, 2, 2, 2,
+    901, 890, 3, 2, 2, 2, 901, 892, 3, 2, 2, 2, 902, 125, 3, 2, 2, 2, 903, 904, 8, 64, 1, 2, 904, 905, 7, 61, 2, 2,
+    905, 906, 5, 124, 63, 2, 906, 910, 7, 62, 2, 2, 907, 909, 5, 100, 51, 2, 908, 907, 3, 2, 2, 2, 909, 912, 3, 2, 2,
+    2, 910, 908, 3, 2, 2, 2, 910, 911, 3, 2, 2, 2, 911, 950, 3, 2, 2, 2, 912, 910, 3, 2, 2, 2, 913, 915, 7, 63, 2, 2,
+    914, 916, 5, 112, 57, 2, 915, 914, 3, 2, 2, 2, 915, 916, 3, 2, 2, 2, 916, 918, 3, 2, 2, 2, 917, 919, 5, 42, 22,
+    2, 918, 917, 3, 2, 2, 2, 918, 919, 3, 2, 2, 2, 919, 920, 3, 2, 2, 2, 920, 950, 7, 64, 2, 2, 921, 922, 7, 63, 2,
+    2, 922, 924, 7, 42, 2, 2, 923, 925, 5, 112, 57, 2, 924, 923, 3, 2, 2, 2, 924, 925, 3, 2, 2, 2, 925, 926, 3, 2, 2,
+    2, 926, 927, 5, 42, 22, 2, 927, 928, 7, 64, 2, 2, 928, 950, 3, 2, 2, 2, 929, 930, 7, 63, 2, 2, 930, 931, 5, 112,
+    57, 2, 931, 932, 7, 42, 2, 2, 932, 933, 5, 42, 22, 2, 933, 934, 7, 64, 2, 2, 934, 950, 3, 2, 2, 2, 935, 936, 7,
+    63, 2, 2, 936, 937, 7, 77, 2, 2, 937, 950, 7, 64, 2, 2, 938, 940, 7, 61, 2, 2, 939, 941, 5, 114, 58, 2, 940, 939,
+    3, 2, 2, 2, 940, 941, 3, 2, 2, 2, 941, 942, 3, 2, 2, 2, 942, 946, 7, 62, 2, 2, 943, 945, 5, 100, 51, 2, 944, 943,
+    3, 2, 2, 2, 945, 948, 3, 2, 2, 2, 946, 944, 3, 2, 2, 2, 946, 947, 3, 2, 2, 2, 947, 950, 3, 2, 2, 2, 948, 946, 3,
+    2, 2, 2, 949, 903, 3, 2, 2, 2, 949, 913, 3, 2, 2, 2, 949, 921, 3, 2, 2, 2, 949, 929, 3, 2, 2, 2, 949, 935, 3, 2,
+    2, 2, 949, 938, 3, 2, 2, 2, 950, 994, 3, 2, 2, 2, 951, 952, 12, 7, 2, 2, 952, 954, 7, 63, 2, 2, 953, 955, 5, 112,
+    57, 2, 954, 953, 3, 2, 2, 2, 954, 955, 3, 2, 2, 2, 955, 957, 3, 2, 2, 2, 956, 958, 5, 42, 22, 2, 957, 956, 3, 2,
+    2, 2, 957, 958, 3, 2, 2, 2, 958, 959, 3, 2, 2, 2, 959, 993, 7, 64, 2, 2, 960, 961, 12, 6, 2, 2, 961, 962, 7, 63,
+    2, 2, 962, 964, 7, 42, 2, 2, 963, 965, 5, 112, 57, 2, 964, 963, 3, 2, 2, 2, 964, 965, 3, 2, 2, 2, 965, 966, 3, 2,
+    2, 2, 966, 967, 5, 42, 22, 2, 967, 968, 7, 64, 2, 2, 968, 993, 3, 2, 2, 2, 969, 970, 12, 5, 2, 2, 970, 971, 7,
+    63, 2, 2, 971, 972, 5, 112, 57, 2, 972, 973, 7, 42, 2, 2, 973, 974, 5, 42, 22, 2, 974, 975, 7, 64, 2, 2, 975,
+    993, 3, 2, 2, 2, 976, 977, 12, 4, 2, 2, 977, 978, 7, 63, 2, 2, 978, 979, 7, 77, 2, 2, 979, 993, 7, 64, 2, 2, 980,
+    981, 12, 3, 2, 2, 981, 983, 7, 61, 2, 2, 982, 984, 5, 114, 58, 2, 983, 982, 3, 2, 2, 2, 983, 984, 3, 2, 2, 2,
+    984, 985, 3, 2, 2, 2, 985, 989, 7, 62, 2, 2, 986, 988, 5, 100, 51, 2, 987, 986, 3, 2, 2, 2, 988, 991, 3, 2, 2, 2,
+    989, 987, 3, 2, 2, 2, 989, 990, 3, 2, 2, 2, 990, 993, 3, 2, 2, 2, 991, 989, 3, 2, 2, 2, 992, 951, 3, 2, 2, 2,
+    992, 960, 3, 2, 2, 2, 992, 969, 3, 2, 2, 2, 992, 976, 3, 2, 2, 2, 992, 980, 3, 2, 2, 2, 993, 996, 3, 2, 2, 2,
+    994, 992, 3, 2, 2, 2, 994, 995, 3, 2, 2, 2, 995, 127, 3, 2, 2, 2, 996, 994, 3, 2, 2, 2, 997, 998, 7, 107, 2, 2,
+    998, 129, 3, 2, 2, 2, 999, 1010, 5, 42, 22, 2, 1000, 1001, 7, 65, 2, 2, 1001, 1002, 5, 132, 67, 2, 1002, 1003, 7,
+    66, 2, 2, 1003, 1010, 3, 2, 2, 2, 1004, 1005, 7, 65, 2, 2, 1005, 1006, 5, 132, 67, 2, 1006, 1007, 7, 90, 2, 2,
+    1007, 1008, 7, 66, 2, 2, 1008, 1010, 3, 2, 2, 2, 1009, 999, 3, 2, 2, 2, 1009, 1000, 3, 2, 2, 2, 1009, 1004, 3, 2,
+    2, 2, 1010, 131, 3, 2, 2, 2, 1011, 1013, 8, 67, 1, 2, 1012, 1014, 5, 134, 68, 2, 1013, 1012, 3, 2, 2, 2, 1013,
+    1014, 3, 2, 2, 2, 1014, 1015, 3, 2, 2, 2, 1015, 1016, 5, 130, 66, 2, 1016, 1025, 3, 2, 2, 2, 1017, 1018, 12, 3,
+    2, 2, 1018, 1020, 7, 90, 2, 2, 1019, 1021, 5, 134, 68, 2, 1020, 1019, 3, 2, 2, 2, 1020, 1021, 3, 2, 2, 2, 1021,
+    1022, 3, 2, 2, 2, 1022, 1024, 5, 130, 66, 2, 1023, 1017, 3, 2, 2, 2, 1024, 1027, 3, 2, 2, 2, 1025, 1023, 3, 2, 2,
+    2, 1025, 1026, 3, 2, 2, 2, 1026, 133, 3, 2, 2, 2, 1027, 1025, 3, 2, 2, 2, 1028, 1029, 5, 136, 69, 2, 1029, 1030,
+    7, 91, 2, 2, 1030, 135, 3, 2, 2, 2, 1031, 1032, 8, 69, 1, 2, 1032, 1033, 5, 138, 70, 2, 1033, 1038, 3, 2, 2, 2,
+    1034, 1035, 12, 3, 2, 2, 1035, 1037, 5, 138, 70, 2, 1036, 1034, 3, 2, 2, 2, 1037, 1040, 3, 2, 2, 2, 1038, 1036,
+    3, 2, 2, 2, 1038, 1039, 3, 2, 2, 2, 1039, 137, 3, 2, 2, 2, 1040, 1038, 3, 2, 2, 2, 1041, 1042, 7, 63, 2, 2, 1042,
+    1043, 5, 48, 25, 2, 1043, 1044, 7, 64, 2, 2, 1044, 1048, 3, 2, 2, 2, 1045, 1046, 7, 105, 2, 2, 1046, 1048, 7,
+    107, 2, 2, 1047, 1041, 3, 2, 2, 2, 1047, 1045, 3, 2, 2, 2, 1048, 139, 3, 2, 2, 2, 1049, 1050, 7, 59, 2, 2, 1050,
+    1051, 7, 61, 2, 2, 1051, 1052, 5, 48, 25, 2, 1052, 1054, 7, 90, 2, 2, 1053, 1055, 7, 109, 2, 2, 1054, 1053, 3, 2,
+    2, 2, 1055, 1056, 3, 2, 2, 2, 1056, 1054, 3, 2, 2, 2, 1056, 1057, 3, 2, 2, 2, 1057, 1058, 3, 2, 2, 2, 1058, 1059,
+    7, 62, 2, 2, 1059, 1060, 7, 89, 2, 2, 1060, 141, 3, 2, 2, 2, 1061, 1099, 5, 144, 73, 2, 1062, 1099, 5, 146, 74,
+    2, 1063, 1099, 5, 152, 77, 2, 1064, 1099, 5, 154, 78, 2, 1065, 1099, 5, 156, 79, 2, 1066, 1099, 5, 158, 80, 2,
+    1067, 1068, 9, 12, 2, 2, 1068, 1069, 9, 13, 2, 2, 1069, 1078, 7, 61, 2, 2, 1070, 1075, 5, 38, 20, 2, 1071, 1072,
+    7, 90, 2, 2, 1072, 1074, 5, 38, 20, 2, 1073, 1071, 3, 2, 2, 2, 1074, 1077, 3, 2, 2, 2, 1075, 1073, 3, 2, 2, 2,
+    1075, 1076, 3, 2, 2, 2, 1076, 1079, 3, 2, 2, 2, 1077, 1075, 3, 2, 2, 2, 1078, 1070, 3, 2, 2, 2, 1078, 1079, 3, 2,
+    2, 2, 1079, 1093, 3, 2, 2, 2, 1080, 1089, 7, 88, 2, 2, 1081, 1086, 5, 38, 20, 2, 1082, 1083, 7, 90, 2, 2, 1083,
+    1085, 5, 38, 20, 2, 1084, 1082, 3, 2, 2, 2, 1085, 1088, 3, 2, 2, 2, 1086, 1084, 3, 2, 2, 2, 1086, 1087, 3, 2, 2,
+    2, 1087, 1090, 3, 2, 2, 2, 1088, 1086, 3, 2, 2, 2, 1089, 1081, 3, 2, 2, 2, 1089, 1090, 3, 2, 2, 2, 1090, 1092, 3,
+    2, 2, 2, 1091, 1080, 3, 2, 2, 2, 1092, 1095, 3, 2, 2, 2, 1093, 1091, 3, 2, 2, 2, 1093, 1094, 3, 2, 2, 2, 1094,
+    1096, 3, 2, 2, 2, 1095, 1093, 3, 2, 2, 2, 1096, 1097, 7, 62, 2, 2, 1097, 1099, 7, 89, 2, 2, 1098, 1061, 3, 2, 2,
+    2, 1098, 1062, 3, 2, 2, 2, 1098, 1063, 3, 2, 2, 2, 1098, 1064, 3, 2, 2, 2, 1098, 1065, 3, 2, 2, 2, 1098, 1066, 3,
+    2, 2, 2, 1098, 1067, 3, 2, 2, 2, 1099, 143, 3, 2, 2, 2, 1100, 1101, 7, 107, 2, 2, 1101, 1102, 7, 88, 2, 2, 1102,
+    1112, 5, 142, 72, 2, 1103, 1104, 7, 19, 2, 2, 1104, 1105, 5, 48, 25, 2, 1105, 1106, 7, 88, 2, 2, 1106, 1107, 5,
+    142, 72, 2, 1107, 1112, 3, 2, 2, 2, 1108, 1109, 7, 23, 2, 2, 1109, 1110, 7, 88, 2, 2, 1110, 1112, 5, 142, 72, 2,
+    1111, 1100, 3, 2, 2, 2, 1111, 1103, 3, 2, 2, 2, 1111, 1108, 3, 2, 2, 2, 1112, 145, 3, 2, 2, 2, 1113, 1115, 7, 65,
+    2, 2, 1114, 1116, 5, 148, 75, 2, 1115, 1114, 3, 2, 2, 2, 1115, 1116, 3, 2, 2, 2, 1116, 1117, 3, 2, 2, 2, 1117,
+    1118, 7, 66, 2, 2, 1118, 147, 3, 2, 2, 2, 1119, 1120, 8, 75, 1, 2, 1120, 1121, 5, 150, 76, 2, 1121, 1126, 3, 2,
+    2, 2, 1122, 1123, 12, 3, 2, 2, 1123, 1125, 5, 150, 76, 2, 1124, 1122, 3, 2, 2, 2, 1125, 1128, 3, 2, 2, 2, 1126,
+    1124, 3, 2, 2, 2, 1126, 1127, 3, 2, 2, 2, 1127, 149, 3, 2, 2, 2, 1128, 1126, 3, 2, 2, 2, 1129, 1132, 5, 50, 26,
+    2, 1130, 1132, 5, 142, 72, 2, 1131, 1129, 3, 2, 2, 2, 1131, 1130, 3, 2, 2, 2, 1132, 151, 3, 2, 2, 2, 1133, 1135,
+    5, 46, 24, 2, 1134, 1133, 3, 2, 2, 2, 1134, 1135, 3, 2, 2, 2, 1135, 1136, 3, 2, 2, 2, 1136, 1137, 7, 89, 2, 2,
+    1137, 153, 3, 2, 2, 2, 1138, 1139, 7, 32, 2, 2, 1139, 1140, 7, 61, 2, 2, 1140, 1141, 5, 46, 24, 2, 1141, 1142, 7,
+    62, 2, 2, 1142, 1145, 5, 142, 72, 2, 1143, 1144, 7, 26, 2, 2, 1144, 1146, 5, 142, 72, 2, 1145, 1143, 3, 2, 2, 2,
+    1145, 1146, 3, 2, 2, 2, 1146, 1154, 3, 2, 2, 2, 1147, 1148, 7, 44, 2, 2, 1148, 1149, 7, 61, 2, 2, 1149, 1150, 5,
+    46, 24, 2, 1150, 1151, 7, 62, 2, 2, 1151, 1152, 5, 142, 72, 2, 1152, 1154, 3, 2, 2, 2, 1153, 1138, 3, 2, 2, 2,
+    1153, 1147, 3, 2, 2, 2, 1154, 155, 3, 2, 2, 2, 1155, 1156, 7, 50, 2, 2, 1156, 1157, 7, 61, 2, 2, 1157, 1158, 5,
+    46, 24, 2, 1158, 1159, 7, 62, 2, 2, 1159, 1160, 5, 142, 72, 2, 1160, 1198, 3, 2, 2, 2, 1161, 1162, 7, 24, 2, 2,
+    1162, 1163, 5, 142, 72, 2, 1163, 1164, 7, 50, 2, 2, 1164, 1165, 7, 61, 2, 2, 1165, 1166, 5, 46, 24, 2, 1166,
+    1167, 7, 62, 2, 2, 1167, 1168, 7, 89, 2, 2, 1168, 1198, 3, 2, 2, 2, 1169, 1170, 7, 30, 2, 2, 1170, 1172, 7, 61,
+    2, 2, 1171, 1173, 5, 46, 24, 2, 1172, 1171, 3, 2, 2, 2, 1172, 1173, 3, 2, 2, 2, 1173, 1174, 3, 2, 2, 2, 1174,
+    1176, 7, 89, 2, 2, 1175, 1177, 5, 46, 24, 2, 1176, 1175, 3, 2, 2, 2, 1176, 1177, 3, 2, 2, 2, 1177, 1178, 3, 2, 2,
+    2, 1178, 1180, 7, 89, 2, 2, 1179, 1181, 5, 46, 24, 2, 1180, 1179, 3, 2, 2, 2, 1180, 1181, 3, 2, 2, 2, 1181, 1182,
+    3, 2, 2, 2, 1182, 1183, 7, 62, 2, 2, 1183, 1198, 5, 142, 72, 2, 1184, 1185, 7, 30, 2, 2, 1185, 1186, 7, 61, 2, 2,
+    1186, 1188, 5, 50, 26, 2, 1187, 1189, 5, 46, 24, 2, 1188, 1187, 3, 2, 2, 2, 1188, 1189, 3, 2, 2, 2, 1189, 1190,
+    3, 2, 2, 2, 1190, 1192, 7, 89, 2, 2, 1191, 1193, 5, 46, 24, 2, 1192, 1191, 3, 2, 2, 2, 1192, 1193, 3, 2, 2, 2,
+    1193, 1194, 3, 2, 2, 2, 1194, 1195, 7, 62, 2, 2, 1195, 1196, 5, 142, 72, 2, 1196, 1198, 3, 2, 2, 2, 1197, 1155,
+    3, 2, 2, 2, 1197, 1161, 3, 2, 2, 2, 1197, 1169, 3, 2, 2, 2, 1197, 1184, 3, 2, 2, 2, 1198, 157, 3, 2, 2, 2, 1199,
+    1200, 7, 31, 2, 2, 1200, 1201, 7, 107, 2, 2, 1201, 1216, 7, 89, 2, 2, 1202, 1203, 7, 22, 2, 2, 1203, 1216, 7, 89,
+    2, 2, 1204, 1205, 7, 18, 2, 2, 1205, 1216, 7, 89, 2, 2, 1206, 1208, 7, 38, 2, 2, 1207, 1209, 5, 46, 24, 2, 1208,
+    1207, 3, 2, 2, 2, 1208, 1209, 3, 2, 2, 2, 1209, 1210, 3, 2, 2, 2, 1210, 1216, 7, 89, 2, 2, 1211, 1212, 7, 31, 2,
+    2, 1212, 1213, 5, 14, 8, 2, 1213, 1214, 7, 89, 2, 2, 1214, 1216, 3, 2, 2, 2, 1215, 1199, 3, 2, 2, 2, 1215, 1202,
+    3, 2, 2, 2, 1215, 1204, 3, 2, 2, 2, 1215, 1206, 3, 2, 2, 2, 1215, 1211, 3, 2, 2, 2, 1216, 159, 3, 2, 2, 2, 1217,
+    1219, 5, 162, 82, 2, 1218, 1217, 3, 2, 2, 2, 1218, 1219, 3, 2, 2, 2, 1219, 1220, 3, 2, 2, 2, 1220, 1221, 7, 2, 2,
+    3, 1221, 161, 3, 2, 2, 2, 1222, 1223, 8, 82, 1, 2, 1223, 1224, 5, 164, 83, 2, 1224, 1229, 3, 2, 2, 2, 1225, 1226,
+    12, 3, 2, 2, 1226, 1228, 5, 164, 83, 2, 1227, 1225, 3, 2, 2, 2, 1228, 1231, 3, 2, 2, 2, 1229, 1227, 3, 2, 2, 2,
+    1229, 1230, 3, 2, 2, 2, 1230, 163, 3, 2, 2, 2, 1231, 1229, 3, 2, 2, 2, 1232, 1236, 5, 166, 84, 2, 1233, 1236, 5,
+    50, 26, 2, 1234, 1236, 7, 89, 2, 2, 1235, 1232, 3, 2, 2, 2, 1235, 1233, 3, 2, 2, 2, 1235, 1234, 3, 2, 2, 2, 1236,
+    165, 3, 2, 2, 2, 1237, 1239, 5, 52, 27, 2, 1238, 1237, 3, 2, 2, 2, 1238, 1239, 3, 2, 2, 2, 1239, 1240, 3, 2, 2,
+    2, 1240, 1242, 5, 96, 49, 2, 1241, 1243, 5, 168, 85, 2, 1242, 1241, 3, 2, 2, 2, 1242, 1243, 3, 2, 2, 2, 1243,
+    1244, 3, 2, 2, 2, 1244, 1245, 5, 146, 74, 2, 1245, 167, 3, 2, 2, 2, 1246, 1247, 8, 85, 1, 2, 1247, 1248, 5, 50,
+    26, 2, 1248, 1253, 3, 2, 2, 2, 1249, 1250, 12, 3, 2, 2, 1250, 1252, 5, 50, 26, 2, 1251, 1249, 3, 2, 2, 2, 1252,
+    1255, 3, 2, 2, 2, 1253, 1251, 3, 2, 2, 2, 1253, 1254, 3, 2, 2, 2, 1254, 169, 3, 2, 2, 2, 1255, 1253, 3, 2, 2, 2,
+    140, 175, 183, 203, 220, 230, 266, 276, 289, 291, 302, 327, 343, 357, 359, 371, 373, 385, 387, 405, 407, 419,
+    421, 432, 443, 454, 465, 476, 485, 492, 504, 511, 516, 521, 526, 533, 543, 551, 569, 573, 582, 593, 598, 603,
+    607, 611, 613, 623, 628, 632, 636, 644, 653, 663, 671, 688, 700, 703, 709, 718, 723, 726, 733, 748, 760, 763,
+    765, 773, 777, 791, 795, 800, 803, 806, 813, 815, 820, 824, 829, 833, 836, 845, 853, 863, 871, 873, 883, 888,
+    892, 898, 901, 910, 915, 918, 924, 940, 946, 949, 954, 957, 964, 983, 989, 992, 994, 1009, 1013, 1020, 1025,
+    1038, 1047, 1056, 1075, 1078, 1086, 1089, 1093, 1098, 1111, 1115, 1126, 1131, 1134, 1145, 1153, 1172, 1176, 1180,
+    1188, 1192, 1197, 1208, 1215, 1218, 1229, 1235, 1238, 1242, 1253
+  };
+
+  const std::vector<std::string> lexerRuleNames = {
+    "T__0", "T__1", "T__2", "T__3", "T__4", "T__5", "T__6", "T__7", "T__8", "T__9", "T__10", "T__11", "T__12",
+    "T__13", "Auto", "Break", "Case", "Char", "Const", "Continue", "Default", "Do", "Double", "Else", "Enum",
+    "Extern", "Float", "For", "Goto", "If", "Inline", "Int", "Long", "Register", "Restrict", "Return", "Short",
+    "Signed", "Sizeof", "Static", "Struct", "Switch", "Typedef", "Union", "Unsigned", "Void", "Volatile", "While",
+    "Alignas", "Alignof", "Atomic", "Bool", "Complex", "Generic", "Imaginary", "Noreturn", "StaticAssert",
+    "ThreadLocal", "LeftParen", "RightParen", "LeftBracket", "RightBracket", "LeftBrace", "RightBrace", "Less",
+    "LessEqual", "Greater", "GreaterEqual", "LeftShift", "RightShift", "Plus", "PlusPlus", "Minus", "MinusMinus",
+    "Star", "Div", "Mod", "And", "Or", "AndAnd", "OrOr", "Caret", "Not", "Tilde", "Question", "Colon", "Semi",
+    "Comma", "Assign", "StarAssign", "DivAssign", "ModAssign", "PlusAssign", "MinusAssign", "LeftShiftAssign",
+    "RightShiftAssign", "AndAssign", "XorAssign", "OrAssign", "Equal", "NotEqual", "Arrow", "Dot", "Ellipsis",
+    "Identifier", "IdentifierNondigit", "Nondigit", "Digit", "UniversalCharacterName", "HexQuad", "Constant",
+    "IntegerConstant", "DecimalConstant", "OctalConstant", "HexadecimalConstant", "HexadecimalPrefix",
+    "NonzeroDigit", "OctalDigit", "HexadecimalDigit", "IntegerSuffix", "UnsignedSuffix", "LongSuffix",
+    "LongLongSuffix", "FloatingConstant", "DecimalFloatingConstant", "HexadecimalFloatingConstant",
+    "FractionalConstant", "ExponentPart", "Sign", "DigitSequence", "HexadecimalFractionalConstant",
+    "BinaryExponentPart", "HexadecimalDigitSequence", "FloatingSuffix", "CharacterConstant", "CCharSequence",
+    "CChar", "EscapeSequence", "SimpleEscapeSequence", "OctalEscapeSequence", "HexadecimalEscapeSequence",
+    "StringLiteral", "EncodingPrefix", "SCharSequence", "SChar", "LineDirective", "PragmaDirective", "Whitespace",
+    "Newline", "BlockComment", "LineComment"
+  };
+
+  const std::vector<std::string> parserRuleNames = {
+    "primaryExpression", "genericSelection", "genericAssocList", "genericAssociation", "postfixExpression",
+    "argumentExpressionList", "unaryExpression", "unaryOperator", "castExpression", "multiplicativeExpression",
+    "additiveExpression", "shiftExpression", "relationalExpression", "equalityExpression", "andExpression",
+    "exclusiveOrExpression", "inclusiveOrExpression", "logicalAndExpression", "logicalOrExpression",
+    "conditionalExpression", "assignmentExpression", "assignmentOperator", "expression", "constantExpression",
+    "declaration", "declarationSpecifiers", "declarationSpecifiers2", "declarationSpecifier", "initDeclaratorList",
+    "initDeclarator", "storageClassSpecifier", "typeSpecifier", "structOrUnionSpecifier", "structOrUnion",
+    "structDeclarationList", "structDeclaration", "specifierQualifierList", "structDeclaratorList",
+    "structDeclarator", "enumSpecifier", "enumeratorList", "enumerator", "enumerationConstant",
+    "atomicTypeSpecifier", "typeQualifier", "functionSpecifier", "alignmentSpecifier", "declarator",
+    "directDeclarator", "gccDeclaratorExtension", "gccAttributeSpecifier", "gccAttributeList", "gccAttribute",
+    "nestedParenthesesBlock", "pointer", "typeQualifierList", "parameterTypeList", "parameterList",
+    "parameterDeclaration", "identifierList", "typeName", "abstractDeclarator", "directAbstractDeclarator",
+    "typedefName", "initializer", "initializerList", "designation", "designatorList", "designator",
+    "staticAssertDeclaration", "statement", "labeledStatement", "compoundStatement", "blockItemList", "blockItem",
+    "expressionStatement", "selectionStatement", "iterationStatement", "jumpStatement", "compilationUnit",
+    "translationUnit", "externalDeclaration", "functionDefinition", "declarationList"
+  };
+
+  const std::vector<std::string> literalNames = {
+    "<INVALID>", "'__extension__'", "'__builtin_va_arg'", "'__builtin_offsetof'", "'__m128'", "'__m128d'",
+    "'__m128i'", "'__typeof__'", "'__inline__'", "'__stdcall'", "'__declspec'", "'__asm'", "'__attribute__'",
+    "'__asm__'", "'__volatile__'", "'auto'", "'break'", "'case'", "'char'", "'const'", "'continue'", "'default'",
+    "'do'", "'double'", "'else'", "'enum'", "'extern'", "'float'", "'for'", "'goto'", "'if'", "'inline'", "'int'",
+    "'long'", "'register'", "'restrict'", "'return'", "'short'", "'signed'", "'sizeof'", "'static'", "'struct'",
+    "'switch'", "'typedef'", "'union'", "'unsigned'", "'void'", "'volatile'", "'while'", "'_Alignas'", "'_Alignof'",
+    "'_Atomic'", "'_Bool'", "'_Complex'", "'_Generic'", "'_Imaginary'", "'_Noreturn'", "'_Static_assert'",
+    "'_Thread_local'", "'('", "')'", "'['", "']'", "'{'", "'}'", "'<'", "'<='", "'>'", "'>='", "'<<'", "'>>'", "'+'",
+    "'++'", "'-'", "'--'", "'*'", "'/'", "'%'", "'&'", "'|'", "'&&'", "'||'", "'^'", "'!'", "'~'", "'?'", "':'",
+    "';'", "','", "'='", "'*='", "'/='", "'%='", "'+='", "'-='", "'<<='", "'>>='", "'&='", "'^='", "'|='", "'=='",
+    "'!='", "'->'", "'.'", "'...'"
+  };
+
+  const std::vector<std::string> symbolicNames = {
+    "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>",
+    "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "<INVALID>", "Auto", "Break",
+    "Case", "Char", "Const", "Continue", "Default", "Do", "Double", "Else", "Enum", "Extern", "Float", "For", "Goto",
+    "If", "Inline", "Int", "Long", "Register", "Restrict", "Return", "Short", "Signed", "Sizeof", "Static", "Struct",
+    "Switch", "Typedef", "Union", "Unsigned", "Void", "Volatile", "While", "Alignas", "Alignof", "Atomic", "Bool",
+    "Complex", "Generic", "Imaginary", "Noreturn", "StaticAssert", "ThreadLocal", "LeftParen", "RightParen",
+    "LeftBracket", "RightBracket", "LeftBrace", "RightBrace", "Less", "LessEqual", "Greater", "GreaterEqual",
+    "LeftShift", "RightShift", "Plus", "PlusPlus", "Minus", "MinusMinus", "Star", "Div", "Mod", "And", "Or",
+    "AndAnd", "OrOr", "Caret", "Not", "Tilde", "Question", "Colon", "Semi", "Comma", "Assign", "StarAssign",
+    "DivAssign", "ModAssign", "PlusAssign", "MinusAssign", "LeftShiftAssign", "RightShiftAssign", "AndAssign",
+    "XorAssign", "OrAssign", "Equal", "NotEqual", "Arrow", "Dot", "Ellipsis", "Identifier", "Constant",
+    "StringLiteral", "LineDirective", "PragmaDirective", "Whitespace", "Newline", "BlockComment", "LineComment"
+  };
+
+} // namespace cgrammar
@@ -0,0 +1,25 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cgrammar {
+
+  extern const std::vector<uint16_t> serializedLexerATN;
+  extern const std::vector<uint16_t> serializedParserATN;
+
+  extern const std::vector<std::string> lexerRuleNames;
+  extern const std::vector<std::string> parserRuleNames;
+  extern const std::vector<std::string> literalNames;
+  extern const std::vector<std::string> symbolicNames;
+
+  const size_t RuleCompilationUnit = 79;
+  const size_t RuleExternalDeclaration = 81;
+
+} // namespace cgrammar
@@ -0,0 +1,649 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+// Benchmarks for the runtime as a whole: lexing, parsing with a cold and a warm DFA, with and without building
+// parse trees, walking trees and parsing on several threads. The input are synthetic C sources of several sizes,
+// parsed with the C grammar in CGrammar.cpp through the interpreters, so no code generation is involved.
+//
+// Every benchmark is named "<benchmark>/<size>". The results can be written as JSON and compared with those of an
+// earlier run, which lists the benchmarks which got slower than the tolerance allows and fails in that case.
+//
+// Usage: antlr4-benchmark [--filter <text>] [--sizes <small,medium,large>] [--repetitions <n>] [--threads <n>]
+//                         [--json <file>] [--baseline <file>] [--tolerance <percent>]
+
+#include "antlr4-runtime.h"
+
+#include "CGrammar.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+using namespace antlr4;
+
+namespace {
+
+  struct Options {
+    std::string filter;
+    std::vector<std::string> sizes = { "small", "medium", "large" };
+    size_t repetitions = 5;
+    size_t threads = std::max(std::thread::hardware_concurrency(), 2U);
+    std::string jsonFile;
+    std::string baselineFile;
+    double tolerance = 10;
+  };
+
+  struct Result {
+    std::string name;
+    size_t bytes;
+    size_t tokens;
+    double best; // Seconds.
+    double median;
+  };
+
+  // The ATNs are deserialized once and shared by all recognizers. Each interpreter has its own DFA, so a new
+  // one starts cold.
+  class Grammar {
+  public:
+    Grammar()
+      : _lexerATN(atn::ATNDeserializer().deserialize(cgrammar::serializedLexerATN)),
+        _parserATN(atn::ATNDeserializer().deserialize(cgrammar::serializedParserATN)),
+        _vocabulary(cgrammar::literalNames, cgrammar::symbolicNames) {
+    }
+
+    std::unique_ptr<Lexer> createLexer(CharStream *input) const {
+      /* mem-check: managed by unique_ptr */
+      std::unique_ptr<Lexer> result(new LexerInterpreter("C.bnf", _vocabulary, cgrammar::lexerRuleNames, {},
+        { "DEFAULT_MODE" }, _lexerATN, input));
+      result->removeErrorListeners();
+      return result;
+    }
+
+    std::unique_ptr<ParserInterpreter> createParser(TokenStream *tokens) const {
+      /* mem-check: managed by unique_ptr */
+      std::unique_ptr<ParserInterpreter> result(new ParserInterpreter("C.bnf", _vocabulary, cgrammar::parserRuleNames,
+        _parserATN, tokens));
+      result->removeErrorListeners();
+      return result;
+    }
+
+  private:
+    atn::ATN _lexerATN;
+    atn::ATN _parserATN;
+    dfa::Vocabulary _vocabulary;
+  };
+
+  // Generates C code with declarations, nested statements and expressions. Uses std::mt19937 directly (and no
+  // distributions), so the same seed gives the same source with every standard library.
+  class SourceGenerator {
+  public:
+    SourceGenerator(unsigned int seed) : _random(seed), _counter(0) {
+    }
+
+    std::string generate(size_t size) {
+      std::string out = "/* Generated benchmark input. */\n\n";
+      while (out.size() < size) {
+        switch (pick(6)) {
+          case 0:
+            out += "struct s" + next() + " {\n  int x;\n  double y[4];\n  const char *name;\n};\n\n";
+            break;
+
+          case 1: {
+            std::string n = next();
+            out += "enum e" + n + " { A" + n + ", B" + n + " = ";
+            out += number();
+            out += ", C" + n + " };\n\n";
+            break;
+          }
+
+          case 2:
+            out += "static int g" + next() + " = ";
+            expression(out, 2);
+            out += ";\n\n";
+            break;
+
+          default: {
+            std::string n = next();
+            out += "/* Function number " + n + ". */\nstatic int f" + n
+              + "(int a, int b, const char *s) {\n  int count = 0, total = 1;\n  double c = 0.5;\n";
+            for (size_t i = 3 + pick(4); i > 0; --i) {
+              statement(out, 2, "  ");
+            }
+            out += "  return a + b;\n}\n\n";
+            break;
+          }
+        }
+      }
+      return out;
+    }
+
+  private:
+    std::mt19937 _random;
+    size_t _counter; // The number of declarations so far.
+
+    size_t pick(size_t count) {
+      return _random() % count;
+    }
+
+    std::string next() {
+      return std::to_string(++_counter);
+    }
+
+    std::string number() {
+      return std::to_string(pick(1000));
+    }
+
+    // Calls one of the functions declared so far (or one declared later, which is fine for the parser).
+    std::string function() {
+      return "f" + std::to_string(pick(_counter + 1));
+    }
+
+    void expression(std::string &out, int depth) {
+      static const char *identifiers[] = { "a", "b", "c", "count", "total" };
+      static const char *binaryOperators[] = { " + ", " - ", " * ", " / ", " % ", " << ", " >> ", " & ", " | ", " ^ ",
+        " && ", " || ", " < ", " > ", " <= ", " >= ", " == ", " != " };
+      static const char *unaryOperators[] = { "-", "!", "~" };
+
+      if (depth <= 0 || pick(3) == 0) {
+        switch (pick(5)) {
+          case 0: out += number(); break;
+          case 1: out += "s[" + number() + "]"; break;
+          case 2: out += "'x'"; break;
+          case 3: out += number() + ".5"; break;
+          default: out += identifiers[pick(5)]; break;
+        }
+        return;
+      }
+
+      switch (pick(6)) {
+        case 0:
+          expression(out, depth - 1);
+          out += binaryOperators[pick(18)];
+          expression(out, depth - 1);
+          break;
+
+        case 1:
+          out += "(";
+          expression(out, depth - 1);
+          out += ")";
+          break;
+
+        case 2:
+          out += unaryOperators[pick(3)];
+          out += "(";
+          expression(out, depth - 1);
+          out += ")";
+          break;
+
+        case 3:
+          out += function() + "(";
+          expression(out, depth - 1);
+          out += ", ";
+          expression(out, depth - 1);
+          out += ", \"text\")";
+          break;
+
+        case 4:
+          expression(out, depth - 1);
+          out += " ? ";
+          expression(out, depth - 1);
+          out += " : ";
+          expression(out, depth - 1);
+          break;
+
+        default:
+          out += "(long)(";
+          expression(out, depth - 1);
+          out += ")";
+          break;
+      }
+    }
+
+    void block(std::string &out, int depth, const std::string &indent) {
+      out += " {\n";
+      for (size_t i = 1 + pick(3); i > 0; --i) {
+        statement(out, depth - 1, indent + "  ");
+      }
+      out += indent + "}";
+    }
+
+    void statement(std::string &out, int depth, const std::string &indent) {
+      out += indent;
+      switch (pick(depth > 0 ? 9 : 4)) {
+        case 0:
+          out += "int v" + next() + " = ";
+          expression(out, 3);
+          out += ";\n";
+          break;
+
+        case 1:
+          out += pick(2) == 0 ? "total += " : "a = ";
+          expression(out, 3);
+          out += ";\n";
+          break;
+
+        case 2:
+          out += "b = " + function() + "(a, ";
+          expression(out, 2);
+          out += ", \"some text\");\n";
+          break;
+
+        case 3:
+          out += "// A line comment with a few words.\n";
+          break;
+
+        case 4:
+          out += "if (";
+          expression(out, 2);
+          out += ")";
+          block(out, depth, indent);
+          if (pick(2) == 0) {
+            out += " else";
+            block(out, depth, indent);
+          }
+          out += "\n";
+          break;
+
+        case 5:
+          out += "while (";
+          expression(out, 2);
+          out += ")";
+          block(out, depth, indent);
+          out += "\n";
+          break;
+
+        case 6:
+          out += "for (int i = 0; i < " + number() + "; ++i)";
+          block(out, depth, indent);
+          out += "\n";
+          break;
+
+        case 7:
+          out += "switch (a) {\n" + indent + "  case " + number() + ":\n" + indent + "    count++;\n" + indent
+            + "    break;\n" + indent + "  default:\n" + indent + "    break;\n" + indent + "}\n";
+          break;
+
+        default:
+          out += "do";
+          block(out, depth, indent);
+          out += " while (";
+          expression(out, 1);
+          out += ");\n";
+          break;
+      }
+    }
+  };
+
+  class CountingListener : public tree::ParseTreeListener {
+  public:
+    size_t count = 0;
+
+    virtual void visitTerminal(tree::TerminalNode * /*node*/) override {
+      ++count;
+    }
+
+    virtual void visitErrorNode(tree::ErrorNode * /*node*/) override {
+      ++count;
+    }
+
+    virtual void enterEveryRule(ParserRuleContext * /*ctx*/) override {
+      ++count;
+    }
+
+    virtual void exitEveryRule(ParserRuleContext * /*ctx*/) override {
+      ++count;
+    }
+
+    static bool enterRule(tree::ParseTreeListener *listener, ParserRuleContext * /*ctx*/) {
+      ++static_cast<CountingListener *>(listener)->count;
+      return true;
+    }
+
+    static void exitRule(tree::ParseTreeListener *listener, ParserRuleContext * /*ctx*/) {
+      ++static_cast<CountingListener *>(listener)->count;
+    }
+
+    static void terminal(tree::ParseTreeListener *listener, tree::TerminalNode * /*node*/) {
+      ++static_cast<CountingListener *>(listener)->count;
+    }
+  };
+
+  class Benchmarks {
+  public:
+    Benchmarks(const Options &options) : _options(options) {
+    }
+
+    const std::vector<Result>& getResults() const {
+      return _results;
+    }
+
+    void run(const std::string &size, const std::string &source) {
+      lex(size, source);
+      parse(size, source);
+      walk(size, source);
+      batch(size, source);
+    }
+
+  private:
+    const Options &_options;
+    Grammar _grammar;
+    std::vector<Result> _results;
+
+    bool selected(const std::string &name) const {
+      return name.find(_options.filter) != std::string::npos;
+    }
+
+    // Runs the function (which returns the number of tokens it handled) the configured number of times.
+    void measure(const std::string &name, size_t bytes, const std::function<size_t ()> &function) {
+      std::vector<double> times;
+      size_t tokens = 0;
+      for (size_t i = 0; i < _options.repetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        tokens = function();
+        times.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+      }
+      std::sort(times.begin(), times.end());
+
+      Result result = { name, bytes, tokens, times.front(), times[times.size() / 2] };
+      _results.push_back(result);
+
+      std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2)
+        << std::setw(12) << result.best * 1000 << std::setw(12) << result.median * 1000
+        << std::setw(12) << bytes / result.best / (1024 * 1024)
+        << std::setw(14) << std::setprecision(0) << tokens / result.best << std::endl;
+    }
+
+    static size_t check(Parser &parser) {
+      if (parser.getNumberOfSyntaxErrors() > 0) {
+        throw std::runtime_error("The benchmark input has syntax errors.");
+      }
+      return 0;
+    }
+
+    void lex(const std::string &size, const std::string &source) {
+      if (selected("lex/cold/" + size)) {
+        measure("lex/cold/" + size, source.size(), [&] {
+          UTF8CharStream input(source);
+          std::unique_ptr<Lexer> lexer = _grammar.createLexer(&input);
+          CommonTokenStream tokens(lexer.get());
+          tokens.fill();
+          return tokens.size();
+        });
+      }
+
+      for (bool table : { false, true }) {
+        std::string name = std::string(table ? "lex/table/" : "lex/warm/") + size;
+        if (!selected(name)) {
+          continue;
+        }
+
+        UTF8CharStream warmInput(source);
+        std::unique_ptr<Lexer> lexer = _grammar.createLexer(&warmInput);
+        if (table) {
+          lexer->getInterpreter<atn::LexerATNSimulator>()->buildDFATables();
+        }
+        CommonTokenStream(lexer.get()).fill();
+
+        measure(name, source.size(), [&] {
+          UTF8CharStream input(source);
+          lexer->setInputStream(&input);
+          CommonTokenStream tokens(lexer.get());
+          tokens.fill();
+          return tokens.size();
+        });
+      }
+    }
+
+    void parse(const std::string &size, const std::string &source) {
+      if (selected("parse/cold/" + size)) {
+        measure("parse/cold/" + size, source.size(), [&] {
+          UTF8CharStream input(source);
+          std::unique_ptr<Lexer> lexer = _grammar.createLexer(&input);
+          CommonTokenStream tokens(lexer.get());
+          std::unique_ptr<ParserInterpreter> parser = _grammar.createParser(&tokens);
+          parser->parse(cgrammar::RuleCompilationUnit);
+          check(*parser);
+          return tokens.size();
+        });
+      }
+
+      for (bool buildTree : { true, false }) {
+        std::string name = std::string(buildTree ? "parse/warm/" : "parse/warm-no-tree/") + size;
+        if (!selected(name)) {
+          continue;
+        }
+
+        UTF8CharStream warmInput(source);
+        std::unique_ptr<Lexer> lexer = _grammar.createLexer(&warmInput);
+        CommonTokenStream warmTokens(lexer.get());
+        std::unique_ptr<ParserInterpreter> parser = _grammar.createParser(&warmTokens);
+        parser->setBuildParseTree(buildTree);
+        parser->parse(cgrammar::RuleCompilationUnit);
+        check(*parser);
+
+        measure(name, source.size(), [&] {
+          UTF8CharStream input(source);
+          lexer->setInputStream(&input);
+          CommonTokenStream tokens(lexer.get());
+          parser->setTokenStream(&tokens);
+          parser->parse(cgrammar::RuleCompilationUnit);
+          size_t result = tokens.size();
+          parser->setTokenStream(&warmTokens); // Releases the tree while the tokens are still there.
+          return result;
+        });
+      }
+    }
+
+    void walk(const std::string &size, const std::string &source) {
+      if (!selected("walk/listener/" + size) && !selected("walk/table/" + size)) {
+        return;
+      }
+
+      UTF8CharStream input(source);
+      std::unique_ptr<Lexer> lexer = _grammar.createLexer(&input);
+      CommonTokenStream tokens(lexer.get());
+      std::unique_ptr<ParserInterpreter> parser = _grammar.createParser(&tokens);
+      tree::ParseTree *tree = parser->parse(cgrammar::RuleCompilationUnit);
+      check(*parser);
+
+      if (selected("walk/listener/" + size)) {
+        measure("walk/listener/" + size, source.size(), [&] {
+          CountingListener listener;
+          tree::ParseTreeWalker::DEFAULT.walk(&listener, tree);
+          return tokens.size();
+        });
+      }
+
+      if (selected("walk/table/" + size)) {
+        tree::RuleDispatchTable table;
+        for (size_t i = 0; i < cgrammar::parserRuleNames.size(); ++i) {
+          table.setEnterHandler(i, &CountingListener::enterRule);
+          table.setExitHandler(i, &CountingListener::exitRule);
+        }
+        table.setTerminalHandler(&CountingListener::terminal);
+
+        measure("walk/table/" + size, source.size(), [&] {
+          CountingListener listener;
+          tree::ParseTreeWalker::DEFAULT.walk(table, &listener, tree);
+          return tokens.size();
+        });
+      }
+    }
+
+    // Parses 16 different inputs of the given size per batch, with 1, 2, 4 ... threads. Each worker keeps its
+    // recognizers (and so its DFAs) between batches, the first batch warms them up.
+    void batch(const std::string &size, const std::string &source) {
+      std::vector<std::string> inputs;
+      for (unsigned int i = 0; i < 16; ++i) {
+        inputs.push_back(SourceGenerator(100 + i).generate(source.size()));
+      }
+      size_t bytes = 0;
+      for (auto &input : inputs) {
+        bytes += input.size();
+      }
+
+      for (size_t threads = 1; threads <= _options.threads; threads *= 2) {
+        std::string name = "batch/" + std::to_string(threads) + "-threads/" + size;
+        if (!selected(name)) {
+          continue;
+        }
+
+        BatchParser parser([this](CharStream *input) {
+          return _grammar.createLexer(input);
+        }, [this](TokenStream *tokens) {
+          return std::unique_ptr<Parser>(_grammar.createParser(tokens).release());
+        }, [](Parser &parser) {
+          return static_cast<ParserInterpreter &>(parser).parse(cgrammar::RuleCompilationUnit);
+        }, threads);
+        parser.parse(inputs);
+
+        measure(name, bytes, [&] {
+          BatchParser::Statistics statistics = parser.parse(inputs);
+          if (statistics.failedInputCount > 0) {
+            throw std::runtime_error("The benchmark input has syntax errors.");
+          }
+          return statistics.tokenCount;
+        });
+      }
+    }
+  };
+
+  void writeJson(const std::string &fileName, const std::vector<Result> &results) {
+    std::ofstream stream(fileName);
+    stream << "[" << std::endl;
+    for (size_t i = 0; i < results.size(); ++i) {
+      const Result &result = results[i];
+      stream << "  {\"name\": \"" << result.name << "\", \"bytes\": " << result.bytes << ", \"tokens\": "
+        << result.tokens << ", \"best\": " << std::setprecision(9) << result.best << ", \"median\": "
+        << result.median << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    stream << "]" << std::endl;
+
+    if (!stream) {
+      throw std::runtime_error("Cannot write " + fileName);
+    }
+  }
+
+  // Reads the best times of a file written by writeJson(), which has one result per line.
+  std::map<std::string, double> readJson(const std::string &fileName) {
+    std::ifstream stream(fileName);
+    if (!stream) {
+      throw std::runtime_error("Cannot read " + fileName);
+    }
+
+    std::map<std::string, double> result;
+    std::string line;
+    while (std::getline(stream, line)) {
+      size_t name = line.find("\"name\": \"");
+      size_t best = line.find("\"best\": ");
+      if (name == std::string::npos || best == std::string::npos) {
+        continue;
+      }
+
+      name += 9;
+      result[line.substr(name, line.find('"', name) - name)] = std::stod(line.substr(best + 8));
+    }
+    return result;
+  }
+
+  // Returns the number of benchmarks which got slower than the tolerance allows.
+  size_t compare(const std::vector<Result> &results, const std::map<std::string, double> &baseline,
+    double tolerance) {
+    size_t regressions = 0;
+    std::cout << std::endl << "Compared with the baseline (best times):" << std::endl;
+    for (auto &result : results) {
+      auto iterator = baseline.find(result.name);
+      if (iterator == baseline.end()) {
+        continue;
+      }
+
+      double change = (result.best / iterator->second - 1) * 100;
+      bool regression = change > tolerance;
+      if (regression) {
+        ++regressions;
+      }
+      std::cout << std::left << std::setw(32) << result.name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(8) << std::showpos << change << std::noshowpos << " %" << (regression ? "  REGRESSION" : "")
+        << std::endl;
+    }
+    return regressions;
+  }
+
+  Options parseArguments(int argc, const char *argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+      std::string argument = argv[i];
+      if (i + 1 == argc) {
+        throw std::invalid_argument("Missing value for " + argument);
+      }
+
+      std::string value = argv[++i];
+      if (argument == "--filter") {
+        options.filter = value;
+      } else if (argument == "--sizes") {
+        options.sizes.clear();
+        std::stringstream stream(value);
+        std::string size;
+        while (std::getline(stream, size, ',')) {
+          options.sizes.push_back(size);
+        }
+      } else if (argument == "--repetitions") {
+        options.repetitions = std::max(std::stoul(value), 1UL);
+      } else if (argument == "--threads") {
+        options.threads = std::max(std::stoul(value), 1UL);
+      } else if (argument == "--json") {
+        options.jsonFile = value;
+      } else if (argument == "--baseline") {
+        options.baselineFile = value;
+      } else if (argument == "--tolerance") {
+        options.tolerance = std::stod(value);
+      } else {
+        throw std::invalid_argument("Unknown option " + argument);
+      }
+    }
+    return options;
+  }
+
+}
+
+int main(int argc, const char *argv[]) {
+  try {
+    Options options = parseArguments(argc, argv);
+
+    const std::map<std::string, size_t> sizes = { { "small", 10 * 1024 }, { "medium", 100 * 1024 },
+      { "large", 1024 * 1024 } };
+
+    std::cout << std::left << std::setw(32) << "benchmark" << std::right << std::setw(12) << "best ms"
+      << std::setw(12) << "median ms" << std::setw(12) << "MB/s" << std::setw(14) << "tokens/s" << std::endl;
+
+    Benchmarks benchmarks(options);
+    for (auto &size : options.sizes) {
+      auto iterator = sizes.find(size);
+      if (iterator == sizes.end()) {
+        throw std::invalid_argument("Unknown size " + size);
+      }
+      benchmarks.run(size, SourceGenerator(1).generate(iterator->second));
+    }
+
+    if (!options.jsonFile.empty()) {
+      writeJson(options.jsonFile, benchmarks.getResults());
+    }
+
+    if (!options.baselineFile.empty()) {
+      size_t regressions = compare(benchmarks.getResults(), readJson(options.baselineFile), options.tolerance);
+      if (regressions > 0) {
+        std::cout << regressions << " benchmark(s) slower than " << options.tolerance << " %." << std::endl;
+        return 1;
+      }
+    }
+  } catch (std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return 2;
+  }
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+// Micro benchmark for the UTF-8 transcoder: decodes, validates and encodes a mostly ASCII and a mixed
+// input with every instruction set the machine supports, and compares that with std::wstring_convert.
+//
+// Usage: antlr4-utf8-benchmark [size in MB]
+
+#include "antlr4-runtime.h"
+
+#include <chrono>
+
+using namespace antlrcpp;
+
+namespace {
+
+  std::string makeInput(size_t size, bool mixed) {
+    const char *ascii = "int main(int argc, char **argv) { return argc > 1 ? atoi(argv[1]) : 0; } // comment\n";
+    const char *other = "grün = \"Größe €\"; // 数据 \xf0\x9f\x98\x80\n";
+
+    std::string result;
+    result.reserve(size + 100);
+    size_t line = 0;
+    while (result.size() < size) {
+      result += (mixed && line++ % 4 == 0) ? other : ascii;
+    }
+    return result;
+  }
+
+  template<typename Function>
+  double measure(size_t bytes, Function function) {
+    const int rounds = 5;
+    double best = 0;
+    for (int i = 0; i < rounds; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      function();
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      double throughput = bytes / elapsed.count() / (1024 * 1024);
+      if (throughput > best)
+        best = throughput;
+    }
+    return best;
+  }
+
+  void report(const std::string &name, double throughput) {
+    std::cout << "  " << name << std::string(name.size() < 24 ? 24 - name.size() : 1, ' ') << throughput << " MB/s" << std::endl;
+  }
+
+  void run(const std::string &title, const std::string &input) {
+    std::cout << title << " (" << input.size() / (1024 * 1024) << " MB)" << std::endl;
+    const char *first = input.data();
+    const char *last = input.data() + input.size();
+
+    UTF32String reference = UTF32Converter().from_bytes(first, last);
+    report("wstring_convert decode", measure(input.size(), [&] {
+      UTF32Converter converter;
+      reference = converter.from_bytes(first, last);
+    }));
+    report("wstring_convert encode", measure(input.size(), [&] {
+      UTF32Converter converter;
+      converter.to_bytes(reference);
+    }));
+
+    for (int i = 0; i <= static_cast<int>(Utf8::bestIsa()); ++i) {
+      Utf8::Isa isa = static_cast<Utf8::Isa>(i);
+      std::string name = Utf8::isaName(isa);
+
+      UTF32String decoded;
+      report(name + " decode", measure(input.size(), [&] {
+        decoded.clear();
+        Utf8::decode(first, last, decoded, isa);
+      }));
+      report(name + " validate", measure(input.size(), [&] {
+        Utf8::validate(first, last, isa);
+      }));
+
+      std::string encoded;
+      report(name + " encode", measure(input.size(), [&] {
+        encoded.clear();
+        Utf8::encode(decoded.data(), decoded.data() + decoded.size(), encoded, isa);
+      }));
+
+      if (decoded != reference || encoded != input) {
+        std::cout << "  " << name << " produced wrong results!" << std::endl;
+      }
+    }
+  }
+
+}
+
+int main(int argc, const char *argv[]) {
+  size_t size = (argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 64) * 1024 * 1024;
+
+  run("ASCII input", makeInput(size, false));
+  run("Mixed input", makeInput(size, true));
+
+  return 0;
+}
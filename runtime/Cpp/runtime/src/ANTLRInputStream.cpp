@@ -136,7 +136,7 @@ std::string ANTLRInputStream::getText(const Interval &interval) {
     return "";
   }
 
-  return antlrcpp::utf32_to_utf8(_data.substr(start, count));
+  return antlrcpp::utf32_to_utf8(_data.data() + start, _data.data() + start + count);
 }
 
 std::string ANTLRInputStream::getSourceName() const {
@@ -0,0 +1,187 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "misc/Interval.h"
+#include "CommonToken.h"
+#include "CharStream.h"
+
+#include "ArenaTokenFactory.h"
+
+#include <atomic>
+#include <cstring>
+
+using namespace antlr4;
+
+namespace {
+
+  const size_t ALIGNMENT = 16;
+
+  inline size_t alignUp(size_t size) {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  }
+
+  // Every token is preceded by a pointer to its slab, which is all operator delete gets to see.
+  const size_t TOKEN_PREFIX = ALIGNMENT;
+
+}
+
+struct ArenaTokenFactory::Slab {
+  // One reference for each token or text placed here, plus one held by the factory while the slab is current.
+  std::atomic<size_t> references;
+  size_t used;
+  size_t capacity;
+
+  char* data() {
+    return reinterpret_cast<char *>(this) + alignUp(sizeof(Slab));
+  }
+};
+
+class ArenaTokenFactory::ArenaToken : public CommonToken {
+public:
+  ArenaToken(std::pair<TokenSource*, CharStream*> source, size_t type, size_t channel, size_t start, size_t stop)
+    : CommonToken(source, type, channel, start, stop) {
+  }
+
+  ArenaToken(size_t type) : CommonToken(type) {
+  }
+
+  virtual ~ArenaToken() {
+    releaseText();
+  }
+
+  static void* operator new(size_t /*size*/, void *place) {
+    return place;
+  }
+
+  static void operator delete(void *place, void * /*place*/) {
+    // Only called if a constructor throws.
+    release(slabOf(place));
+  }
+
+  static void operator delete(void *place) {
+    release(slabOf(place));
+  }
+
+  virtual void setText(const std::string &text) override {
+    releaseText();
+    CommonToken::setText(text);
+  }
+
+  virtual std::string getText() const override {
+    if (_arenaText != nullptr) {
+      return std::string(_arenaText, _arenaTextLength);
+    }
+    return CommonToken::getText();
+  }
+
+  void setArenaText(const char *text, size_t length, Slab *slab) {
+    releaseText();
+    _arenaText = text;
+    _arenaTextLength = length;
+    _textSlab = slab;
+  }
+
+protected:
+  virtual bool hasText() const override {
+    return _arenaText != nullptr || CommonToken::hasText();
+  }
+
+private:
+  const char *_arenaText = nullptr;
+  size_t _arenaTextLength = 0;
+  Slab *_textSlab = nullptr;
+
+  static Slab* slabOf(void *place) {
+    return *reinterpret_cast<Slab **>(static_cast<char *>(place) - TOKEN_PREFIX);
+  }
+
+  void releaseText() {
+    if (_textSlab != nullptr) {
+      release(_textSlab);
+      _textSlab = nullptr;
+    }
+    _arenaText = nullptr;
+    _arenaTextLength = 0;
+  }
+};
+
+ArenaTokenFactory::ArenaTokenFactory(bool copyText_, size_t slabSize_)
+  : copyText(copyText_), slabSize(slabSize_), _current(nullptr) {
+}
+
+ArenaTokenFactory::~ArenaTokenFactory() {
+  if (_current != nullptr) {
+    release(_current);
+  }
+}
+
+std::unique_ptr<CommonToken> ArenaTokenFactory::create(std::pair<TokenSource*, CharStream*> source, size_t type,
+  const std::string &text, size_t channel, size_t start, size_t stop, size_t line, size_t charPositionInLine) {
+
+  Slab *slab;
+  char *memory = static_cast<char *>(allocate(TOKEN_PREFIX + sizeof(ArenaToken), slab));
+  *reinterpret_cast<Slab **>(memory) = slab;
+  std::unique_ptr<CommonToken> t(new (memory + TOKEN_PREFIX) ArenaToken(source, type, channel, start, stop));
+
+  t->setLine(line);
+  t->setCharPositionInLine(charPositionInLine);
+  if (text != "") {
+    setText(t.get(), text);
+  } else if (copyText && source.second != nullptr) {
+    setText(t.get(), source.second->getText(misc::Interval(start, stop)));
+  }
+
+  return t;
+}
+
+std::unique_ptr<CommonToken> ArenaTokenFactory::create(size_t type, const std::string &text) {
+  Slab *slab;
+  char *memory = static_cast<char *>(allocate(TOKEN_PREFIX + sizeof(ArenaToken), slab));
+  *reinterpret_cast<Slab **>(memory) = slab;
+  std::unique_ptr<CommonToken> t(new (memory + TOKEN_PREFIX) ArenaToken(type));
+
+  setText(t.get(), text);
+  return t;
+}
+
+void* ArenaTokenFactory::allocate(size_t size, Slab *&slab) {
+  size = alignUp(size);
+  if (_current == nullptr || _current->capacity - _current->used < size) {
+    if (_current != nullptr) {
+      release(_current); // Freed as soon as the last token in it is gone.
+    }
+
+    size_t capacity = std::max(slabSize, size);
+    void *memory = ::operator new(alignUp(sizeof(Slab)) + capacity); /* mem-check: freed in release() */
+    _current = new (memory) Slab();
+    _current->references.store(1, std::memory_order_relaxed);
+    _current->used = 0;
+    _current->capacity = capacity;
+  }
+
+  slab = _current;
+  void *result = slab->data() + slab->used;
+  slab->used += size;
+  slab->references.fetch_add(1, std::memory_order_relaxed);
+  return result;
+}
+
+void ArenaTokenFactory::release(Slab *slab) {
+  if (slab->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    slab->~Slab();
+    ::operator delete(slab);
+  }
+}
+
+void ArenaTokenFactory::setText(CommonToken *token, const std::string &text) {
+  if (text.empty()) {
+    return;
+  }
+
+  Slab *slab;
+  char *memory = static_cast<char *>(allocate(text.size(), slab));
+  std::memcpy(memory, text.data(), text.size());
+  static_cast<ArenaToken *>(token)->setArenaText(memory, text.size(), slab);
+}
@@ -0,0 +1,56 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "TokenFactory.h"
+
+namespace antlr4 {
+
+  /// A {@link TokenFactory} which places its tokens (and their text, if any) in large memory slabs
+  /// instead of allocating each token separately from the heap. Use it like:
+  ///
+  ///   lexer.setTokenFactory(std::make_shared<ArenaTokenFactory>());
+  ///
+  /// The tokens are still handed out as std::unique_ptr<CommonToken>, so token streams and generated code
+  /// don't see a difference. Deleting such a token only runs its destructor, the memory is returned once
+  /// all tokens in a slab are gone (usually when the token stream is reset or destroyed). Each slab
+  /// counts the tokens living in it, so tokens may outlive the factory (and the lexer owning it).
+  ///
+  /// A factory instance should only be used by one lexer at a time.
+  class ANTLR4CPP_PUBLIC ArenaTokenFactory : public TokenFactory<CommonToken> {
+  public:
+    static const size_t DEFAULT_SLAB_SIZE = 64 * 1024;
+
+    /// See {@link CommonTokenFactory#copyText} for the copyText parameter.
+    ArenaTokenFactory(bool copyText = false, size_t slabSize = DEFAULT_SLAB_SIZE);
+    ArenaTokenFactory(const ArenaTokenFactory &other) = delete;
+    virtual ~ArenaTokenFactory();
+
+    ArenaTokenFactory& operator = (const ArenaTokenFactory &other) = delete;
+
+    virtual std::unique_ptr<CommonToken> create(std::pair<TokenSource*, CharStream*> source, size_t type,
+      const std::string &text, size_t channel, size_t start, size_t stop, size_t line, size_t charPositionInLine) override;
+
+    virtual std::unique_ptr<CommonToken> create(size_t type, const std::string &text) override;
+
+  protected:
+    const bool copyText;
+    const size_t slabSize;
+
+  private:
+    struct Slab;
+    class ArenaToken;
+
+    Slab *_current;
+
+    /// Reserves size bytes in the current slab (or a new one) and adds a reference to that slab.
+    void* allocate(size_t size, Slab *&slab);
+    static void release(Slab *slab);
+
+    void setText(CommonToken *token, const std::string &text);
+  };
+
+} // namespace antlr4
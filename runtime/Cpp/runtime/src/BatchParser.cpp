@@ -0,0 +1,269 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "BaseErrorListener.h"
+#include "CommonTokenStream.h"
+#include "Exceptions.h"
+#include "Lexer.h"
+#include "MappedFileStream.h"
+#include "Parser.h"
+#include "UTF8CharStream.h"
+
+#include "BatchParser.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace antlr4;
+
+namespace {
+
+  // Work ranges are packed into one word (begin in the lower, end in the upper half), so that the owner
+  // and thieves can update them with a single compare-and-swap.
+  inline uint64_t packRange(uint64_t begin, uint64_t end) {
+    return begin | (end << 32);
+  }
+
+  inline size_t rangeBegin(uint64_t range) {
+    return static_cast<size_t>(range & 0xFFFFFFFF);
+  }
+
+  inline size_t rangeEnd(uint64_t range) {
+    return static_cast<size_t>(range >> 32);
+  }
+
+  class ErrorCollector : public BaseErrorListener {
+  public:
+    std::vector<BatchParser::Error> *errors = nullptr;
+
+    virtual void syntaxError(Recognizer * /*recognizer*/, Token * /*offendingSymbol*/, size_t line,
+      size_t charPositionInLine, const std::string &msg, std::exception_ptr /*e*/) override {
+      errors->push_back({ line, charPositionInLine, msg });
+    }
+  };
+
+}
+
+//------------------ Worker --------------------------------------------------------------------------------------------
+
+class BatchParser::Worker {
+public:
+  std::atomic<uint64_t> range;
+
+  // Per batch counters, only touched by the thread running this worker.
+  size_t characterCount;
+  size_t tokenCount;
+  std::exception_ptr callbackException;
+
+  Worker(BatchParser &owner) : range(0), characterCount(0), tokenCount(0), _owner(owner) {
+  }
+
+  /// Takes the next input from the own range.
+  bool take(size_t &index) {
+    uint64_t current = range.load();
+    while (rangeBegin(current) < rangeEnd(current)) {
+      if (range.compare_exchange_weak(current, packRange(rangeBegin(current) + 1, rangeEnd(current)))) {
+        index = rangeBegin(current);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Moves the upper half of the victim's remaining inputs into the (empty) own range.
+  bool steal(Worker &victim) {
+    uint64_t current = victim.range.load();
+    while (rangeBegin(current) < rangeEnd(current)) {
+      size_t middle = rangeBegin(current) + (rangeEnd(current) - rangeBegin(current)) / 2;
+      if (victim.range.compare_exchange_weak(current, packRange(rangeBegin(current), middle))) {
+        range.store(packRange(middle, rangeEnd(current)));
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void process(size_t index, const StreamFactory &streamFactory, const TreeCallback &callback,
+    InputResult &result) {
+    _errors.errors = &result.errors;
+
+    ParserRuleContext *tree = nullptr;
+    try {
+      std::unique_ptr<UTF8CharStream> input = streamFactory(index);
+      characterCount += input->byteSize();
+
+      if (_parser == nullptr) {
+        create(input.get());
+      } else {
+        // The lexer still references the previous input while switching, so that is released afterwards.
+        _lexer->setInputStream(input.get());
+        _tokens->setTokenSource(_lexer.get());
+        _parser->setTokenStream(_tokens.get());
+      }
+      _input = std::move(input);
+
+      tree = _owner._startRule(*_parser);
+      tokenCount += _tokens->size();
+    } catch (std::exception &e) {
+      result.errors.push_back({ 0, 0, e.what() });
+    }
+    result.success = tree != nullptr && result.errors.empty();
+
+    if (tree != nullptr && callback) {
+      try {
+        callback(index, tree, *_parser);
+      } catch (...) {
+        if (!callbackException) {
+          callbackException = std::current_exception();
+        }
+      }
+    }
+  }
+
+private:
+  BatchParser &_owner;
+  ErrorCollector _errors;
+
+  std::unique_ptr<UTF8CharStream> _input;
+  std::unique_ptr<Lexer> _lexer;
+  std::unique_ptr<CommonTokenStream> _tokens;
+  std::unique_ptr<Parser> _parser;
+
+  void create(CharStream *input) {
+    _parser.reset();
+    _tokens.reset();
+
+    _lexer = _owner._lexerFactory(input);
+    _lexer->removeErrorListeners();
+    _lexer->addErrorListener(&_errors);
+
+    _tokens.reset(new CommonTokenStream(_lexer.get())); /* mem-check: managed by unique_ptr */
+
+    _parser = _owner._parserFactory(_tokens.get());
+    _parser->removeErrorListeners();
+    _parser->addErrorListener(&_errors);
+  }
+};
+
+//------------------ Statistics ----------------------------------------------------------------------------------------
+
+double BatchParser::Statistics::inputsPerSecond() const {
+  return seconds > 0 ? inputCount / seconds : 0;
+}
+
+double BatchParser::Statistics::charactersPerSecond() const {
+  return seconds > 0 ? characterCount / seconds : 0;
+}
+
+double BatchParser::Statistics::tokensPerSecond() const {
+  return seconds > 0 ? tokenCount / seconds : 0;
+}
+
+//------------------ BatchParser ---------------------------------------------------------------------------------------
+
+BatchParser::BatchParser(LexerFactory lexerFactory, ParserFactory parserFactory, StartRule startRule,
+  size_t threadCount)
+  : _lexerFactory(std::move(lexerFactory)), _parserFactory(std::move(parserFactory)),
+    _startRule(std::move(startRule)), _threadCount(threadCount) {
+  if (_threadCount == 0) {
+    _threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+}
+
+BatchParser::~BatchParser() {
+}
+
+size_t BatchParser::getThreadCount() const {
+  return _threadCount;
+}
+
+BatchParser::Statistics BatchParser::parse(const std::vector<std::string> &inputs, const TreeCallback &callback) {
+  return run(inputs.size(), [&inputs](size_t index) {
+    return std::unique_ptr<UTF8CharStream>(new UTF8CharStream(inputs[index])); /* mem-check: managed by unique_ptr */
+  }, callback);
+}
+
+BatchParser::Statistics BatchParser::parseFiles(const std::vector<std::string> &fileNames,
+  const TreeCallback &callback) {
+  return run(fileNames.size(), [&fileNames](size_t index) {
+    /* mem-check: managed by unique_ptr */
+    return std::unique_ptr<UTF8CharStream>(new MappedFileStream(fileNames[index]));
+  }, callback);
+}
+
+BatchParser::Statistics BatchParser::run(size_t inputCount, const StreamFactory &streamFactory,
+  const TreeCallback &callback) {
+  if (inputCount > 0xFFFFFFFF) {
+    throw IllegalArgumentException("A batch can hold at most 2^32 - 1 inputs");
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  Statistics statistics;
+  statistics.inputCount = inputCount;
+  statistics.results.resize(inputCount, { false, {} });
+  statistics.threadCount = std::max<size_t>(std::min(_threadCount, inputCount), 1);
+
+  while (_workers.size() < statistics.threadCount) {
+    _workers.emplace_back(new Worker(*this)); /* mem-check: managed by unique_ptr */
+  }
+
+  for (size_t i = 0; i < statistics.threadCount; ++i) {
+    Worker &worker = *_workers[i];
+    worker.range.store(packRange(i * inputCount / statistics.threadCount,
+      (i + 1) * inputCount / statistics.threadCount));
+    worker.characterCount = 0;
+    worker.tokenCount = 0;
+    worker.callbackException = nullptr;
+  }
+
+  auto work = [&](size_t workerIndex) {
+    Worker &worker = *_workers[workerIndex];
+    while (true) {
+      size_t index;
+      while (worker.take(index)) {
+        worker.process(index, streamFactory, callback, statistics.results[index]);
+      }
+
+      bool stolen = false;
+      for (size_t i = 1; i < statistics.threadCount && !stolen; ++i) {
+        stolen = worker.steal(*_workers[(workerIndex + i) % statistics.threadCount]);
+      }
+      if (!stolen) {
+        break;
+      }
+    }
+  };
+
+  // The calling thread is one of the workers.
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < statistics.threadCount; ++i) {
+    threads.emplace_back(work, i);
+  }
+  work(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  statistics.failedInputCount = 0;
+  for (auto &result : statistics.results) {
+    if (!result.success) {
+      ++statistics.failedInputCount;
+    }
+  }
+
+  statistics.characterCount = 0;
+  statistics.tokenCount = 0;
+  for (size_t i = 0; i < statistics.threadCount; ++i) {
+    statistics.characterCount += _workers[i]->characterCount;
+    statistics.tokenCount += _workers[i]->tokenCount;
+    if (_workers[i]->callbackException) {
+      std::rethrow_exception(_workers[i]->callbackException);
+    }
+  }
+
+  statistics.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return statistics;
+}
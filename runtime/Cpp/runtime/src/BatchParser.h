@@ -0,0 +1,102 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlr4 {
+
+  /// Parses many inputs in parallel with one grammar. Each worker thread creates its lexer, token stream and
+  /// parser once (through the given factories) and reuses them for all inputs it handles, also over several
+  /// calls of parse(). The work is distributed by work stealing: every worker starts with an equal share of
+  /// the inputs and takes over half of the remaining inputs of another worker when it runs out of work.
+  ///
+  /// Generated recognizers share their DFAs and context cache between all instances, so the DFA warmed up by
+  /// one worker speeds up all others. LexerInterpreter and ParserInterpreter have their own DFAs, so with them
+  /// every worker warms up separately.
+  ///
+  ///   BatchParser batch(
+  ///     [](CharStream *input) { return std::unique_ptr<Lexer>(new MyLexer(input)); },
+  ///     [](TokenStream *tokens) { return std::unique_ptr<Parser>(new MyParser(tokens)); },
+  ///     [](Parser &parser) -> ParserRuleContext* { return static_cast<MyParser &>(parser).file(); });
+  ///   BatchParser::Statistics statistics = batch.parse(texts, [&](size_t index, ParserRuleContext *tree, Parser &) {
+  ///     results[index] = analyze(tree); // Runs on the worker thread.
+  ///   });
+  class ANTLR4CPP_PUBLIC BatchParser {
+  public:
+    typedef std::function<std::unique_ptr<Lexer>(CharStream *input)> LexerFactory;
+    typedef std::function<std::unique_ptr<Parser>(TokenStream *tokens)> ParserFactory;
+
+    /// Invokes the start rule on the parser and returns the resulting tree.
+    typedef std::function<ParserRuleContext* (Parser &parser)> StartRule;
+
+    /// Called on a worker thread for every input which could be parsed (possibly with syntax errors). The tree
+    /// is owned by the parser and released when that parses its next input, so anything which must outlive
+    /// the callback has to be extracted from the tree here. Calls for different inputs run concurrently.
+    typedef std::function<void (size_t index, ParserRuleContext *tree, Parser &parser)> TreeCallback;
+
+    struct ANTLR4CPP_PUBLIC Error {
+      size_t line;
+      size_t charPositionInLine;
+      std::string message;
+    };
+
+    /// Syntax errors reported by the lexer or parser of an input, or the message of an exception which stopped
+    /// its parsing (e.g. a ParseCancellationException from a BailErrorStrategy).
+    struct ANTLR4CPP_PUBLIC InputResult {
+      bool success; // Parsed completely and without errors.
+      std::vector<Error> errors;
+    };
+
+    struct ANTLR4CPP_PUBLIC Statistics {
+      size_t inputCount;
+      size_t failedInputCount;
+      size_t characterCount; // UTF-8 bytes.
+      size_t tokenCount;
+      size_t threadCount;
+      double seconds; // Wall time of the whole batch.
+
+      /// One result per input, in input order.
+      std::vector<InputResult> results;
+
+      double inputsPerSecond() const;
+      double charactersPerSecond() const;
+      double tokensPerSecond() const;
+    };
+
+    /// threadCount 0 uses one thread per hardware thread.
+    BatchParser(LexerFactory lexerFactory, ParserFactory parserFactory, StartRule startRule, size_t threadCount = 0);
+    BatchParser(const BatchParser &other) = delete;
+    ~BatchParser();
+
+    BatchParser& operator = (const BatchParser &other) = delete;
+
+    size_t getThreadCount() const;
+
+    /// Parses the given UTF-8 encoded texts. They are not copied and must stay unchanged during the call.
+    /// The error listeners of the recognizers are replaced by one which collects the errors for the result.
+    /// Not reentrant: a BatchParser handles one batch at a time.
+    Statistics parse(const std::vector<std::string> &inputs, const TreeCallback &callback = nullptr);
+
+    /// Parses the given UTF-8 encoded files, which are memory mapped for that. A file which cannot be read
+    /// counts as failed input, with the reason as its error.
+    Statistics parseFiles(const std::vector<std::string> &fileNames, const TreeCallback &callback = nullptr);
+
+  private:
+    class Worker;
+
+    LexerFactory _lexerFactory;
+    ParserFactory _parserFactory;
+    StartRule _startRule;
+    size_t _threadCount;
+    std::vector<std::unique_ptr<Worker>> _workers; // Kept between batches.
+
+    typedef std::function<std::unique_ptr<UTF8CharStream> (size_t index)> StreamFactory;
+
+    Statistics run(size_t inputCount, const StreamFactory &streamFactory, const TreeCallback &callback);
+  };
+
+} // namespace antlr4
@@ -19,6 +19,12 @@ BufferedTokenStream::BufferedTokenStream(TokenSource *tokenSource) : _tokenSourc
   InitializeInstanceFields();
 }
 
+BufferedTokenStream::BufferedTokenStream(TokenSource *tokenSource, bool compact) : BufferedTokenStream(tokenSource) {
+  if (compact) {
+    _compactTokens.reset(new TokenBuffer()); /* mem-check: managed by unique_ptr */
+  }
+}
+
 TokenSource* BufferedTokenStream::getTokenSource() const {
   return _tokenSource;
 }
@@ -45,7 +51,7 @@ void BufferedTokenStream::seek(size_t index) {
 }
 
 size_t BufferedTokenStream::size() {
-  return _tokens.size();
+  return tokenCount();
 }
 
 void BufferedTokenStream::consume() {
@@ -54,10 +60,10 @@ void BufferedTokenStream::consume() {
     if (_fetchedEOF) {
       // the last token in tokens is EOF. skip check if p indexes any
       // fetched token except the last.
-      skipEofCheck = _p < _tokens.size() - 1;
+      skipEofCheck = _p < tokenCount() - 1;
     } else {
       // no EOF token in tokens. skip check if p indexes a fetched token.
-      skipEofCheck = _p < _tokens.size();
+      skipEofCheck = _p < tokenCount();
     }
   } else {
     // not yet initialized
@@ -74,9 +80,9 @@ void BufferedTokenStream::consume() {
 }
 
 bool BufferedTokenStream::sync(size_t i) {
-  if (i + 1 < _tokens.size())
+  if (i + 1 < tokenCount())
     return true;
-  size_t n = i - _tokens.size() + 1; // how many more elements we need?
+  size_t n = i - tokenCount() + 1; // how many more elements we need?
 
   if (n > 0) {
     size_t fetched = fetch(n);
@@ -94,15 +100,20 @@ size_t BufferedTokenStream::fetch(size_t n) {
   size_t i = 0;
   while (i < n) {
     std::unique_ptr<Token> t(_tokenSource->nextToken());
+    bool isEOF = t->getType() == Token::EOF;
 
-    if (is<WritableToken *>(t.get())) {
-      (static_cast<WritableToken *>(t.get()))->setTokenIndex(_tokens.size());
-    }
+    if (_compactTokens) {
+      _compactTokens->add(t.get());
+    } else {
+      if (is<WritableToken *>(t.get())) {
+        (static_cast<WritableToken *>(t.get()))->setTokenIndex(tokenCount());
+      }
 
-    _tokens.push_back(std::move(t));
+      _tokens.push_back(std::move(t));
+    }
     ++i;
 
-    if (_tokens.back()->getType() == Token::EOF) {
+    if (isEOF) {
       _fetchedEOF = true;
       break;
     }
@@ -112,13 +123,13 @@ size_t BufferedTokenStream::fetch(size_t n) {
 }
 
 Token* BufferedTokenStream::get(size_t i) const {
-  if (i >= _tokens.size()) {
+  if (i >= tokenCount()) {
     throw IndexOutOfBoundsException(std::string("token index ") +
                                     std::to_string(i) +
                                     std::string(" out of range 0..") +
-                                    std::to_string(_tokens.size() - 1));
+                                    std::to_string(tokenCount() - 1));
   }
-  return _tokens[i].get();
+  return tokenAt(i);
 }
 
 std::vector<Token *> BufferedTokenStream::get(size_t start, size_t stop) {
@@ -126,15 +137,15 @@ std::vector<Token *> BufferedTokenStream::get(size_t start, size_t stop) {
 
   lazyInit();
 
-  if (_tokens.empty()) {
+  if (tokenCount() == 0) {
     return subset;
   }
 
-  if (stop >= _tokens.size()) {
-    stop = _tokens.size() - 1;
+  if (stop >= tokenCount()) {
+    stop = tokenCount() - 1;
   }
   for (size_t i = start; i <= stop; i++) {
-    Token *t = _tokens[i].get();
+    Token *t = tokenAt(i);
     if (t->getType() == Token::EOF) {
       break;
     }
@@ -151,7 +162,7 @@ Token* BufferedTokenStream::LB(size_t k) {
   if (k > _p) {
     return nullptr;
   }
-  return _tokens[_p - k].get();
+  return tokenAt(_p - k);
 }
 
 Token* BufferedTokenStream::LT(ssize_t k) {
@@ -165,12 +176,12 @@ Token* BufferedTokenStream::LT(ssize_t k) {
 
   size_t i = _p + k - 1;
   sync(i);
-  if (i >= _tokens.size()) { // return EOF token
+  if (i >= tokenCount()) { // return EOF token
                              // EOF must be last token
-    return _tokens.back().get();
+    return tokenAt(tokenCount() - 1);
   }
 
-  return _tokens[i].get();
+  return tokenAt(i);
 }
 
 ssize_t BufferedTokenStream::adjustSeekIndex(size_t i) {
@@ -192,14 +203,17 @@ void BufferedTokenStream::setup() {
 void BufferedTokenStream::setTokenSource(TokenSource *tokenSource) {
   _tokenSource = tokenSource;
   _tokens.clear();
+  if (_compactTokens) {
+    _compactTokens->clear();
+  }
   _fetchedEOF = false;
   _needSetup = true;
 }
 
 std::vector<Token *> BufferedTokenStream::getTokens() {
   std::vector<Token *> result;
-  for (auto &t : _tokens)
-    result.push_back(t.get());
+  for (size_t i = 0; i < tokenCount(); ++i)
+    result.push_back(tokenAt(i));
   return result;
 }
 
@@ -209,13 +223,13 @@ std::vector<Token *> BufferedTokenStream::getTokens(size_t start, size_t stop) {
 
 std::vector<Token *> BufferedTokenStream::getTokens(size_t start, size_t stop, const std::vector<size_t> &types) {
   lazyInit();
-  if (stop >= _tokens.size() || start >= _tokens.size()) {
+  if (stop >= tokenCount() || start >= tokenCount()) {
     throw IndexOutOfBoundsException(std::string("start ") +
                                     std::to_string(start) +
                                     std::string(" or stop ") +
                                     std::to_string(stop) +
                                     std::string(" not in 0..") +
-                                    std::to_string(_tokens.size() - 1));
+                                    std::to_string(tokenCount() - 1));
   }
 
   std::vector<Token *> filteredTokens;
@@ -225,7 +239,7 @@ std::vector<Token *> BufferedTokenStream::getTokens(size_t start, size_t stop, c
   }
 
   for (size_t i = start; i <= stop; i++) {
-    Token *tok = _tokens[i].get();
+    Token *tok = tokenAt(i);
 
     if (types.empty() || std::find(types.begin(), types.end(), tok->getType()) != types.end()) {
       filteredTokens.push_back(tok);
@@ -246,14 +260,12 @@ ssize_t BufferedTokenStream::nextTokenOnChannel(size_t i, size_t channel) {
     return size() - 1;
   }
 
-  Token *token = _tokens[i].get();
-  while (token->getChannel() != channel) {
-    if (token->getType() == Token::EOF) {
+  while (tokenChannelAt(i) != channel) {
+    if (tokenTypeAt(i) == Token::EOF) {
       return i;
     }
     i++;
     sync(i);
-    token = _tokens[i].get();
   }
   return i;
 }
@@ -266,8 +278,7 @@ ssize_t BufferedTokenStream::previousTokenOnChannel(size_t i, size_t channel) {
   }
 
   while (true) {
-    Token *token = _tokens[i].get();
-    if (token->getType() == Token::EOF || token->getChannel() == channel) {
+    if (tokenTypeAt(i) == Token::EOF || tokenChannelAt(i) == channel) {
       return i;
     }
 
@@ -280,8 +291,8 @@ ssize_t BufferedTokenStream::previousTokenOnChannel(size_t i, size_t channel) {
 
 std::vector<Token *> BufferedTokenStream::getHiddenTokensToRight(size_t tokenIndex, ssize_t channel) {
   lazyInit();
-  if (tokenIndex >= _tokens.size()) {
-    throw IndexOutOfBoundsException(std::to_string(tokenIndex) + " not in 0.." + std::to_string(_tokens.size() - 1));
+  if (tokenIndex >= tokenCount()) {
+    throw IndexOutOfBoundsException(std::to_string(tokenIndex) + " not in 0.." + std::to_string(tokenCount() - 1));
   }
 
   ssize_t nextOnChannel = nextTokenOnChannel(tokenIndex + 1, Lexer::DEFAULT_TOKEN_CHANNEL);
@@ -303,8 +314,8 @@ std::vector<Token *> BufferedTokenStream::getHiddenTokensToRight(size_t tokenInd
 
 std::vector<Token *> BufferedTokenStream::getHiddenTokensToLeft(size_t tokenIndex, ssize_t channel) {
   lazyInit();
-  if (tokenIndex >= _tokens.size()) {
-    throw IndexOutOfBoundsException(std::to_string(tokenIndex) + " not in 0.." + std::to_string(_tokens.size() - 1));
+  if (tokenIndex >= tokenCount()) {
+    throw IndexOutOfBoundsException(std::to_string(tokenIndex) + " not in 0.." + std::to_string(tokenCount() - 1));
   }
 
   if (tokenIndex == 0) {
@@ -330,7 +341,7 @@ std::vector<Token *> BufferedTokenStream::getHiddenTokensToLeft(size_t tokenInde
 std::vector<Token *> BufferedTokenStream::filterForChannel(size_t from, size_t to, ssize_t channel) {
   std::vector<Token *> hidden;
   for (size_t i = from; i <= to; i++) {
-    Token *t = _tokens[i].get();
+    Token *t = tokenAt(i);
     if (channel == -1) {
       if (t->getChannel() != Lexer::DEFAULT_TOKEN_CHANNEL) {
         hidden.push_back(t);
@@ -369,13 +380,13 @@ std::string BufferedTokenStream::getText(const misc::Interval &interval) {
   if (start == INVALID_INDEX || stop == INVALID_INDEX) {
     return "";
   }
-  if (stop >= _tokens.size()) {
-    stop = _tokens.size() - 1;
+  if (stop >= tokenCount()) {
+    stop = tokenCount() - 1;
   }
 
   std::stringstream ss;
   for (size_t i = start; i <= stop; i++) {
-    Token *t = _tokens[i].get();
+    Token *t = tokenAt(i);
     if (t->getType() == Token::EOF) {
       break;
     }
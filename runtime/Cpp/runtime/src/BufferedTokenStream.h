@@ -6,6 +6,7 @@
 #pragma once
 
 #include "TokenStream.h"
+#include "TokenBuffer.h"
 
 namespace antlr4 {
 
@@ -24,6 +25,11 @@ namespace antlr4 {
   class ANTLR4CPP_PUBLIC BufferedTokenStream : public TokenStream {
   public:
     BufferedTokenStream(TokenSource *tokenSource);
+
+    /// With compact set to true fetched tokens are copied into a TokenBuffer and the source tokens are released
+    /// right away. The tokens returned by this stream are then read-only TokenBuffer::TokenViews, which needs
+    /// much less memory for large inputs. Don't use this mode if you need to modify tokens after they were fetched.
+    BufferedTokenStream(TokenSource *tokenSource, bool compact);
     BufferedTokenStream(const BufferedTokenStream& other) = delete;
 
     BufferedTokenStream& operator = (const BufferedTokenStream& other) = delete;
@@ -107,6 +113,9 @@ namespace antlr4 {
      */
     std::vector<std::unique_ptr<Token>> _tokens;
 
+    /// Replaces _tokens in compact mode (null otherwise).
+    std::unique_ptr<TokenBuffer> _compactTokens;
+
     /**
      * The index into {@link #tokens} of the current token (next token to
      * {@link #consume}). {@link #tokens}{@code [}{@link #p}{@code ]} should be
@@ -192,6 +201,23 @@ namespace antlr4 {
 
     bool isInitialized() const;
 
+    // Token access independent of the storage mode.
+    size_t tokenCount() const {
+      return _compactTokens ? _compactTokens->size() : _tokens.size();
+    }
+
+    Token* tokenAt(size_t i) const {
+      return _compactTokens ? _compactTokens->get(i) : _tokens[i].get();
+    }
+
+    size_t tokenTypeAt(size_t i) const {
+      return _compactTokens ? _compactTokens->getType(i) : _tokens[i]->getType();
+    }
+
+    size_t tokenChannelAt(size_t i) const {
+      return _compactTokens ? _compactTokens->getChannel(i) : _tokens[i]->getChannel();
+    }
+
   private:
     bool _needSetup;
     void InitializeInstanceFields();
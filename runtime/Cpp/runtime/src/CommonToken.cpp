@@ -59,7 +59,9 @@ CommonToken::CommonToken(Token *oldToken) {
   _stop = oldToken->getStopIndex();
 
   if (is<CommonToken *>(oldToken)) {
-    _text = (static_cast<CommonToken *>(oldToken))->_text;
+    if (static_cast<CommonToken *>(oldToken)->hasText()) {
+      _text = oldToken->getText();
+    }
     _source = (static_cast<CommonToken *>(oldToken))->_source;
   } else {
     _text = oldToken->getText();
@@ -96,6 +98,10 @@ void CommonToken::setText(const std::string &text) {
   _text = text;
 }
 
+bool CommonToken::hasText() const {
+  return !_text.empty();
+}
+
 size_t CommonToken::getLine() const {
   return _line;
 }
@@ -10,6 +10,8 @@
 namespace antlr4 {
 
   class ANTLR4CPP_PUBLIC CommonToken : public WritableToken {
+    friend class TokenBuffer; // Needs to know if a token has explicit text.
+
   protected:
     /**
      * An empty {@link Pair} which is used as the default value of
@@ -151,6 +153,11 @@ namespace antlr4 {
     virtual std::string toString() const override;
 
     virtual std::string toString(Recognizer *r) const;
+
+  protected:
+    /// True if this token has explicitly set text, i.e. getText() doesn't come from the input stream.
+    virtual bool hasText() const;
+
   private:
     void InitializeInstanceFields();
   };
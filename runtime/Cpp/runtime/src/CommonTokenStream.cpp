@@ -16,6 +16,10 @@ CommonTokenStream::CommonTokenStream(TokenSource *tokenSource, size_t channel_)
 : BufferedTokenStream(tokenSource), channel(channel_) {
 }
 
+CommonTokenStream::CommonTokenStream(TokenSource *tokenSource, size_t channel_, bool compact)
+: BufferedTokenStream(tokenSource, compact), channel(channel_) {
+}
+
 ssize_t CommonTokenStream::adjustSeekIndex(size_t i) {
   return nextTokenOnChannel(i, channel);
 }
@@ -37,7 +41,7 @@ Token* CommonTokenStream::LB(size_t k) {
     return nullptr;
   }
 
-  return _tokens[i].get();
+  return tokenAt(i);
 }
 
 Token* CommonTokenStream::LT(ssize_t k) {
@@ -59,18 +63,17 @@ Token* CommonTokenStream::LT(ssize_t k) {
     n++;
   }
 
-  return _tokens[i].get();
+  return tokenAt(i);
 }
 
 int CommonTokenStream::getNumberOfOnChannelTokens() {
   int n = 0;
   fill();
-  for (size_t i = 0; i < _tokens.size(); i++) {
-    Token *t = _tokens[i].get();
-    if (t->getChannel() == channel) {
+  for (size_t i = 0; i < tokenCount(); i++) {
+    if (tokenChannelAt(i) == channel) {
       n++;
     }
-    if (t->getType() == Token::EOF) {
+    if (tokenTypeAt(i) == Token::EOF) {
       break;
     }
   }
@@ -55,6 +55,16 @@ namespace antlr4 {
      */
     CommonTokenStream(TokenSource *tokenSource, size_t channel);
 
+    /**
+     * Like above, but optionally stores the tokens in a compact {@link TokenBuffer}
+     * (see {@link BufferedTokenStream#BufferedTokenStream(TokenSource *, bool)}).
+     *
+     * @param tokenSource The token source.
+     * @param channel The channel to use for filtering tokens.
+     * @param compact Use a compact token buffer.
+     */
+    CommonTokenStream(TokenSource *tokenSource, size_t channel, bool compact);
+
     virtual Token* LT(ssize_t k) override;
 
     /// Count EOF just once.
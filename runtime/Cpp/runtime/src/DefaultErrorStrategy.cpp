@@ -100,7 +100,7 @@ void DefaultErrorStrategy::sync(Parser *recognizer) {
   size_t la = tokens->LA(1);
 
   // try cheaper subset first; might get lucky. seems to shave a wee bit off
-  auto nextTokens = recognizer->getATN().nextTokens(s);
+  const misc::IntervalSet &nextTokens = recognizer->getATN().nextTokens(s);
   if (nextTokens.contains(Token::EPSILON) || nextTokens.contains(la)) {
     return;
   }
@@ -300,23 +300,9 @@ std::string DefaultErrorStrategy::escapeWSAndQuote(const std::string &s) const {
 }
 
 misc::IntervalSet DefaultErrorStrategy::getErrorRecoverySet(Parser *recognizer) {
+  // What follows who invoked us, for all invocations on the stack. Memoized per stack in the ATN.
   const atn::ATN &atn = recognizer->getInterpreter<atn::ATNSimulator>()->atn;
-  RuleContext *ctx = recognizer->getContext();
-  misc::IntervalSet recoverSet;
-  while (ctx->invokingState != ATNState::INVALID_STATE_NUMBER) {
-    // compute what follows who invoked us
-    atn::ATNState *invokingState = atn.states[ctx->invokingState];
-    atn::RuleTransition *rt = dynamic_cast<atn::RuleTransition*>(invokingState->transitions[0]);
-    misc::IntervalSet follow = atn.nextTokens(rt->followState);
-    recoverSet.addAll(follow);
-
-    if (ctx->parent == nullptr)
-      break;
-    ctx = static_cast<RuleContext *>(ctx->parent);
-  }
-  recoverSet.remove(Token::EPSILON);
-
-  return recoverSet;
+  return atn.getErrorRecoverySet(recognizer->getContext());
 }
 
 void DefaultErrorStrategy::consumeUntil(Parser *recognizer, const misc::IntervalSet &set) {
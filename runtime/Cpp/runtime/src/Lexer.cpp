@@ -140,6 +140,10 @@ Ref<TokenFactory<CommonToken>> Lexer::getTokenFactory() {
   return _factory;
 }
 
+void Lexer::setTokenFactory(Ref<TokenFactory<CommonToken>> factory) {
+  _factory = factory;
+}
+
 void Lexer::setInputStream(IntStream *input) {
   reset();
   _input = dynamic_cast<CharStream*>(input);
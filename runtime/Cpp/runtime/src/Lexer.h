@@ -100,6 +100,9 @@ namespace antlr4 {
       this->_factory = factory;
     }
 
+    /// Sets the factory used to create the tokens this lexer emits (e.g. an ArenaTokenFactory).
+    virtual void setTokenFactory(Ref<TokenFactory<CommonToken>> factory);
+
     virtual Ref<TokenFactory<CommonToken>> getTokenFactory() override;
 
     /// Set the char stream and reset the lexer
@@ -0,0 +1,23 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "MappedFileStream.h"
+
+using namespace antlr4;
+
+MappedFileStream::MappedFileStream(const std::string &fileName)
+  : _fileName(fileName), _file(fileName, true) { // The lexer walks the input front to back.
+  // Empty files simply result in an empty stream.
+  if (_file.data() != nullptr) {
+    setData(_file.data(), _file.size());
+  }
+}
+
+MappedFileStream::~MappedFileStream() {
+}
+
+std::string MappedFileStream::getSourceName() const {
+  return _fileName;
+}
@@ -0,0 +1,35 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "UTF8CharStream.h"
+#include "support/MappedFile.h"
+
+namespace antlr4 {
+
+  /// A UTF8CharStream over a memory mapped file. The file content is neither copied nor converted,
+  /// so even very large files can be lexed without reading them into memory first.
+  /// The file must not be modified while the stream exists.
+  class ANTLR4CPP_PUBLIC MappedFileStream : public UTF8CharStream {
+  public:
+    // Assumes a file name encoded in UTF-8 and file content in the same encoding (with or w/o BOM).
+    // Throws an IOException if the file cannot be opened or mapped.
+    MappedFileStream(const std::string &fileName);
+    MappedFileStream(const MappedFileStream &other) = delete;
+    virtual ~MappedFileStream();
+
+    MappedFileStream& operator = (const MappedFileStream &other) = delete;
+
+    virtual std::string getSourceName() const override;
+
+  protected:
+    std::string _fileName; // UTF-8 encoded file name.
+
+  private:
+    antlrcpp::MappedFile _file;
+  };
+
+} // namespace antlr4
@@ -19,7 +19,10 @@
 #include "atn/ATN.h"
 #include "Exceptions.h"
 #include "ANTLRErrorListener.h"
+#include "BailErrorStrategy.h"
+#include "tree/ParseTreeWalker.h"
 #include "tree/pattern/ParseTreePattern.h"
+#include "support/CPPUtils.h"
 
 #include "atn/ProfilingATNSimulator.h"
 #include "atn/ParseInfo.h"
@@ -97,6 +100,7 @@ void Parser::reset() {
   _precedenceStack.clear();
   _precedenceStack.push_back(0);
   _ctx = nullptr;
+  _streamedParent = nullptr;
   _tracker.reset();
 
   atn::ATNSimulator *interpreter = getInterpreter<atn::ParserATNSimulator>();
@@ -332,7 +336,14 @@ void Parser::addContextToParseTree() {
   parent->addChild(_ctx);
 }
 
-void Parser::enterRule(ParserRuleContext *localctx, size_t state, size_t /*ruleIndex*/) {
+void Parser::enterRule(ParserRuleContext *localctx, size_t state, size_t ruleIndex) {
+  if (_subtreeHandler && ruleIndex == _streamedRuleIndex && _streamedParent == nullptr && _buildParseTrees &&
+      localctx->parent != nullptr) {
+    _streamedParent = dynamic_cast<ParserRuleContext *>(localctx->parent);
+    _streamedMark = _tracker.markBefore(localctx);
+    _streamedTokenMarker = _input->mark();
+  }
+
   setState(state);
   _ctx = localctx;
   _ctx->start = _input->LT(1);
@@ -356,8 +367,14 @@ void Parser::exitRule() {
   if (_parseListeners.size() > 0) {
     triggerExitRuleEvent();
   }
+  ParserRuleContext *finished = _ctx;
   setState(_ctx->invokingState);
   _ctx = dynamic_cast<ParserRuleContext *>(_ctx->parent);
+
+  // While a subtree is streamed only its root has the streamed parent as parent.
+  if (_streamedParent != nullptr && _ctx == _streamedParent) {
+    releaseSubtree(finished);
+  }
 }
 
 void Parser::enterOuterAlt(ParserRuleContext *localctx, size_t altNum) {
@@ -634,6 +651,127 @@ tree::ErrorNode *Parser::createErrorNode(Token *t) {
   return _tracker.createInstance<tree::ErrorNodeImpl>(t);
 }
 
+void Parser::setSubtreeHandler(size_t ruleIndex, SubtreeHandler handler) {
+  _streamedRuleIndex = ruleIndex;
+  _subtreeHandler = std::move(handler);
+}
+
+ParserRuleContext* Parser::parseTwoStage(std::function<ParserRuleContext* ()> const& startRule, ParseStage *stage) {
+  if (_ctx != nullptr) {
+    throw IllegalStateException("A two-stage parse cannot be started from within a rule");
+  }
+  if (_subtreeHandler) {
+    throw IllegalStateException("A two-stage parse cannot stream subtrees");
+  }
+
+  atn::ParserATNSimulator *interpreter = getInterpreter<atn::ParserATNSimulator>();
+  atn::PredictionMode mode = interpreter->getPredictionMode();
+
+  // The listeners which must be replayed after an SLL parse. Without a tree there is nothing to replay.
+  std::vector<tree::ParseTreeListener *> parseListeners = _parseListeners;
+  std::vector<tree::ParseTreeListener *> replayedListeners;
+  for (auto listener : parseListeners) {
+    if (listener != _tracer) {
+      replayedListeners.push_back(listener);
+    }
+  }
+
+  if (_buildParseTrees || replayedListeners.empty()) {
+    Ref<ANTLRErrorStrategy> errorHandler = _errHandler;
+    ProxyErrorListener errorListeners = getErrorListenerDispatch();
+    size_t state = getState();
+    size_t syntaxErrors = _syntaxErrors;
+    bool matchedEOF = _matchedEOF;
+    std::vector<int> precedenceStack = _precedenceStack;
+    _input->LA(1); // Sets up a stream which initializes lazily, so that its index is valid.
+    size_t startIndex = _input->index();
+    tree::ParseTreeTracker::Mark treeMark = _tracker.mark();
+
+    ParserRuleContext *result = nullptr;
+    bool bailed = false;
+    {
+      ssize_t marker = _input->mark(); // Keeps the tokens of an unbuffered stream for the second stage.
+      auto onExit = finally([&] {
+        _errHandler = errorHandler;
+        getErrorListenerDispatch() = errorListeners;
+        _parseListeners = parseListeners;
+        interpreter->setPredictionMode(mode);
+        _input->release(marker);
+      });
+
+      _errHandler = std::make_shared<BailErrorStrategy>();
+      getErrorListenerDispatch().removeErrorListeners();
+      _parseListeners.clear();
+      if (_tracer != nullptr) {
+        _parseListeners.push_back(_tracer);
+      }
+      interpreter->setPredictionMode(atn::PredictionMode::SLL);
+
+      try {
+        result = startRule();
+      } catch (ParseCancellationException & /*e*/) {
+        bailed = true;
+        _input->seek(startIndex);
+      }
+    }
+
+    if (!bailed) {
+      for (auto listener : replayedListeners) {
+        tree::ParseTreeWalker::DEFAULT.walk(listener, result);
+      }
+      if (stage != nullptr) {
+        *stage = ParseStage::SLL;
+      }
+      return result;
+    }
+
+    // The partial tree hangs on no other node (the parse started outside of any rule), so it can go at once.
+    _tracker.rewind(treeMark);
+    _ctx = nullptr;
+    setState(state);
+    _syntaxErrors = syntaxErrors;
+    _matchedEOF = matchedEOF;
+    _precedenceStack = precedenceStack;
+  }
+
+  if (stage != nullptr) {
+    *stage = ParseStage::LL;
+  }
+  if (mode != atn::PredictionMode::SLL) {
+    return startRule();
+  }
+
+  interpreter->setPredictionMode(atn::PredictionMode::LL);
+  auto onExit = finally([interpreter, mode] {
+    interpreter->setPredictionMode(mode);
+  });
+  return startRule();
+}
+
+void Parser::releaseSubtree(ParserRuleContext *tree) {
+  ParserRuleContext *parent = _streamedParent;
+  _streamedParent = nullptr;
+
+  _subtreeHandler(tree);
+
+  // The parent's child list may have been grown for the subtree, in which case it lives in the part of the
+  // arena which is released and must be rebuilt afterwards.
+  parent->removeLastChild();
+  if (_tracker.isAfter(_streamedMark, parent->children.begin())) {
+    std::vector<tree::ParseTree *> siblings = parent->children;
+    parent->children.clear();
+    parent->children.shrink_to_fit();
+    _tracker.rewind(_streamedMark);
+    for (auto sibling : siblings) {
+      parent->children.push_back(sibling);
+    }
+  } else {
+    _tracker.rewind(_streamedMark);
+  }
+
+  _input->release(_streamedTokenMarker);
+}
+
 void Parser::InitializeInstanceFields() {
   _errHandler = std::make_shared<DefaultErrorStrategy>();
   _precedenceStack.clear();
@@ -644,5 +782,8 @@ void Parser::InitializeInstanceFields() {
   _input = nullptr;
   _tracer = nullptr;
   _ctx = nullptr;
+  _streamedRuleIndex = INVALID_INDEX;
+  _streamedParent = nullptr;
+  _streamedTokenMarker = 0;
 }
 
@@ -118,7 +118,8 @@ namespace antlr4 {
     /// This property is set to {@code false} by default for a newly constructed parser.
     /// </summary>
     /// <param name="trimParseTrees"> {@code true} to trim the capacity of the <seealso cref="ParserRuleContext#children"/>
-    /// list to its size after a rule is parsed. </param>
+    /// list to its size after a rule is parsed. Children lists living in the parse tree arena
+    /// (see <seealso cref="tree::ParseTreeTracker"/>) are not affected by this. </param>
     virtual void setTrimParseTree(bool trimParseTrees);
 
     /// <returns> {@code true} if the <seealso cref="ParserRuleContext#children"/> list is trimmed
@@ -377,6 +378,55 @@ namespace antlr4 {
 
     tree::ParseTreeTracker& getTreeTracker() { return _tracker; }
 
+    typedef std::function<void (ParserRuleContext *tree)> SubtreeHandler;
+
+    /// Switches on streaming for huge inputs (pass a null handler to switch it off again). Every completed
+    /// subtree of the given rule is passed to the handler and released afterwards: it is removed from its
+    /// parent, its nodes are given back to the tree arena and the token stream mark held for it is released,
+    /// so an UnbufferedTokenStream can drop its tokens. Memory then stays proportional to the largest of these
+    /// subtrees instead of the whole input. Typically the rule is the repeated one in a top level rule like
+    /// {@code file: statement* EOF}. Invocations of the rule nested in a streamed subtree are part of it.
+    ///
+    /// The rule must not be left recursive and its invocation must not be labeled (the context it returns is
+    /// gone). Tokens need their own text when the char stream is unbuffered too (see CommonTokenFactory).
+    /// The enclosing contexts keep their other children, but with an unbuffered token stream their tokens
+    /// (including their start token) are released as well and must not be accessed.
+    void setSubtreeHandler(size_t ruleIndex, SubtreeHandler handler);
+
+    /// The stage of parseTwoStage() which produced the parse tree.
+    enum class ParseStage {
+      SLL, // The fast pass, with PredictionMode::SLL and a BailErrorStrategy.
+      LL   // The full pass, with PredictionMode::LL and the parser's own error handler.
+    };
+
+    /// Parses with the given start rule (e.g. {@code [&] { return parser.file(); }}) in two stages, which is
+    /// the fastest way to get a correct parse for typical input. The first stage uses SLL prediction and bails
+    /// out at the first syntax error, with error listeners switched off. Only if that fails (because the
+    /// input has syntax errors or needs full context prediction) the input is parsed again, with LL prediction
+    /// (or the parser's prediction mode, if that is not SLL), the parser's error handler and its listeners.
+    ///
+    /// For the second stage the token stream is rewound to where the first one started, so tokens it already
+    /// buffered are not lexed again. The partial tree of the first stage is released at once and the parser
+    /// state (error handler, prediction mode, listeners, error count) is as if that stage never ran. Parse
+    /// listeners see only the successful stage: after an SLL parse the finished tree is walked for them (except
+    /// the trace listener, which traces both stages as they happen). Without a parse tree that is not possible,
+    /// so the SLL stage is skipped then if parse listeners are registered.
+    ///
+    /// Must be called outside of any rule and without a subtree handler. The stage which produced the result
+    /// is stored in {@code stage}, if given.
+    ParserRuleContext* parseTwoStage(std::function<ParserRuleContext* ()> const& startRule, ParseStage *stage = nullptr);
+
+    /// The same as parseTwoStage() above for a start rule of a generated parser, e.g.
+    /// {@code parser.parseTwoStage(&MyParser::file)}. Returns the rule's own context type.
+    template<typename P, typename Context>
+    Context* parseTwoStage(Context* (P::*startRule)(), ParseStage *stage = nullptr) {
+      static_assert(std::is_base_of<Parser, P>::value, "The start rule must belong to a parser");
+      P *parser = static_cast<P *>(this);
+      return static_cast<Context *>(parseTwoStage([parser, startRule]() -> ParserRuleContext* {
+        return (parser->*startRule)();
+      }, stage));
+    }
+
     /** How to create a token leaf node associated with a parent.
      *  Typically, the terminal node to create is not a function of the parent
      *  but this method must still set the parent pointer of the terminal node
@@ -461,6 +511,17 @@ namespace antlr4 {
     /// other parser methods.
     TraceListener *_tracer;
 
+    size_t _streamedRuleIndex;
+    SubtreeHandler _subtreeHandler;
+
+    // The parent of the streamed subtree currently parsed (null if there is none), the arena position before
+    // it and the token stream mark which keeps its tokens.
+    ParserRuleContext *_streamedParent;
+    tree::ParseTreeTracker::Mark _streamedMark;
+    ssize_t _streamedTokenMarker;
+
+    void releaseSubtree(ParserRuleContext *tree);
+
     void InitializeInstanceFields();
   };
 
@@ -66,6 +66,7 @@ void ParserInterpreter::reset() {
   Parser::reset();
   _overrideDecisionReached = false;
   _overrideDecisionRoot = nullptr;
+  _errorTokens.clear();
 }
 
 const atn::ATN& ParserInterpreter::getATN() const {
@@ -286,17 +287,17 @@ void ParserInterpreter::recover(RecognitionException &e) {
       InputMismatchException &ime = static_cast<InputMismatchException&>(e);
       Token *tok = e.getOffendingToken();
       size_t expectedTokenType = ime.getExpectedTokens().getMinElement(); // get any element
-      _errorToken = getTokenFactory()->create({ tok->getTokenSource(), tok->getTokenSource()->getInputStream() },
+      _errorTokens.push_back(getTokenFactory()->create({ tok->getTokenSource(), tok->getTokenSource()->getInputStream() },
         expectedTokenType, tok->getText(), Token::DEFAULT_CHANNEL, INVALID_INDEX, INVALID_INDEX, // invalid start/stop
-        tok->getLine(), tok->getCharPositionInLine());
-      _ctx->addChild(createErrorNode(_errorToken.get()));
+        tok->getLine(), tok->getCharPositionInLine()));
+      _ctx->addChild(createErrorNode(_errorTokens.back().get()));
     }
     else { // NoViableAlt
       Token *tok = e.getOffendingToken();
-      _errorToken = getTokenFactory()->create({ tok->getTokenSource(), tok->getTokenSource()->getInputStream() },
+      _errorTokens.push_back(getTokenFactory()->create({ tok->getTokenSource(), tok->getTokenSource()->getInputStream() },
         Token::INVALID_TYPE, tok->getText(), Token::DEFAULT_CHANNEL, INVALID_INDEX, INVALID_INDEX, // invalid start/stop
-        tok->getLine(), tok->getCharPositionInLine());
-      _ctx->addChild(createErrorNode(_errorToken.get()));
+        tok->getLine(), tok->getCharPositionInLine()));
+      _ctx->addChild(createErrorNode(_errorTokens.back().get()));
     }
   }
 }
@@ -173,7 +173,7 @@ namespace antlr4 {
 
   private:
     const dfa::Vocabulary &_vocabulary;
-    std::unique_ptr<Token> _errorToken;
+    std::vector<std::unique_ptr<Token>> _errorTokens; // Referenced by the error nodes of the current tree.
   };
 
 } // namespace antlr4
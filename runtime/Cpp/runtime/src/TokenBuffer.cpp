@@ -0,0 +1,198 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "CommonToken.h"
+#include "CharStream.h"
+#include "Exceptions.h"
+#include "misc/Interval.h"
+#include "support/CPPUtils.h"
+#include "support/StringUtils.h"
+
+#include "TokenBuffer.h"
+
+using namespace antlr4;
+using namespace antlrcpp;
+
+TokenBuffer::TokenView::TokenView(const TokenBuffer *buffer, size_t index) : _buffer(buffer), _index(index) {
+}
+
+std::string TokenBuffer::TokenView::getText() const {
+  return _buffer->getText(_index);
+}
+
+size_t TokenBuffer::TokenView::getType() const {
+  return _buffer->getType(_index);
+}
+
+size_t TokenBuffer::TokenView::getLine() const {
+  return _buffer->getLine(_index);
+}
+
+size_t TokenBuffer::TokenView::getCharPositionInLine() const {
+  return _buffer->getCharPositionInLine(_index);
+}
+
+size_t TokenBuffer::TokenView::getChannel() const {
+  return _buffer->getChannel(_index);
+}
+
+size_t TokenBuffer::TokenView::getTokenIndex() const {
+  return _index;
+}
+
+size_t TokenBuffer::TokenView::getStartIndex() const {
+  return _buffer->getStartIndex(_index);
+}
+
+size_t TokenBuffer::TokenView::getStopIndex() const {
+  return _buffer->getStopIndex(_index);
+}
+
+TokenSource* TokenBuffer::TokenView::getTokenSource() const {
+  return _buffer->getTokenSource(_index);
+}
+
+CharStream* TokenBuffer::TokenView::getInputStream() const {
+  return _buffer->getInputStream(_index);
+}
+
+std::string TokenBuffer::TokenView::toString() const {
+  // Same format as CommonToken::toString().
+  std::stringstream ss;
+
+  std::string channelStr;
+  size_t channel = getChannel();
+  if (channel > 0) {
+    channelStr = ",channel=" + std::to_string(channel);
+  }
+  std::string txt = getText();
+  if (!txt.empty()) {
+    antlrcpp::replaceAll(txt, "\n", "\\n");
+    antlrcpp::replaceAll(txt, "\r", "\\r");
+    antlrcpp::replaceAll(txt, "\t", "\\t");
+  } else {
+    txt = "<no text>";
+  }
+
+  ss << "[@" << misc::symbolToNumeric(_index) << "," << misc::symbolToNumeric(getStartIndex()) << ":"
+    << misc::symbolToNumeric(getStopIndex()) << "='" << txt << "',<" << misc::symbolToNumeric(getType()) << ">"
+    << channelStr << "," << getLine() << ":" << getCharPositionInLine() << "]";
+  return ss.str();
+}
+
+//------------------ TokenBuffer ---------------------------------------------------------------------------------------
+
+TokenBuffer::TokenBuffer() : _source(nullptr, nullptr) {
+}
+
+void TokenBuffer::add(const Token *token) {
+  size_t index = _types.size();
+
+  std::pair<TokenSource *, CharStream *> source = { token->getTokenSource(), token->getInputStream() };
+  if (index == 0) {
+    _source = source;
+  } else if (source != _source) {
+    _otherSources[index] = source;
+  }
+
+  // Only keep text which doesn't come from the char stream.
+  if (is<const CommonToken *>(token)) {
+    if (static_cast<const CommonToken *>(token)->hasText()) {
+      _texts[index] = token->getText();
+    }
+  } else {
+    _texts[index] = token->getText();
+  }
+
+  _types.push_back(narrow(token->getType()));
+  _channels.push_back(narrow(token->getChannel()));
+  _lines.push_back(narrow(token->getLine()));
+  _columns.push_back(narrow(token->getCharPositionInLine()));
+  _starts.push_back(token->getStartIndex());
+  _stops.push_back(token->getStopIndex());
+
+  _views.emplace_back(this, index);
+}
+
+size_t TokenBuffer::getLine(size_t index) const {
+  return widen(_lines[index]);
+}
+
+size_t TokenBuffer::getCharPositionInLine(size_t index) const {
+  return widen(_columns[index]);
+}
+
+size_t TokenBuffer::getStartIndex(size_t index) const {
+  return _starts[index];
+}
+
+size_t TokenBuffer::getStopIndex(size_t index) const {
+  return _stops[index];
+}
+
+std::string TokenBuffer::getText(size_t index) const {
+  if (!_texts.empty()) {
+    auto iterator = _texts.find(index);
+    if (iterator != _texts.end()) {
+      return iterator->second;
+    }
+  }
+
+  // Same logic as in CommonToken::getText().
+  CharStream *input = getInputStream(index);
+  if (input == nullptr) {
+    return "";
+  }
+
+  size_t n = input->size();
+  if (_starts[index] < n && _stops[index] < n) {
+    return input->getText(misc::Interval(_starts[index], _stops[index]));
+  } else {
+    return "<EOF>";
+  }
+}
+
+TokenSource* TokenBuffer::getTokenSource(size_t index) const {
+  if (!_otherSources.empty()) {
+    auto iterator = _otherSources.find(index);
+    if (iterator != _otherSources.end()) {
+      return iterator->second.first;
+    }
+  }
+  return _source.first;
+}
+
+CharStream* TokenBuffer::getInputStream(size_t index) const {
+  if (!_otherSources.empty()) {
+    auto iterator = _otherSources.find(index);
+    if (iterator != _otherSources.end()) {
+      return iterator->second.second;
+    }
+  }
+  return _source.second;
+}
+
+void TokenBuffer::clear() {
+  _types.clear();
+  _channels.clear();
+  _lines.clear();
+  _columns.clear();
+  _starts.clear();
+  _stops.clear();
+  _source = { nullptr, nullptr };
+  _otherSources.clear();
+  _texts.clear();
+  _views.clear();
+}
+
+uint32_t TokenBuffer::narrow(size_t value) {
+  if (value == INVALID_INDEX) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  if (value >= std::numeric_limits<uint32_t>::max()) {
+    throw IllegalArgumentException("token field value " + std::to_string(value) + " too large for a compact token buffer");
+  }
+  return static_cast<uint32_t>(value);
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "Token.h"
+
+#include <deque>
+
+namespace antlr4 {
+
+  /// Compact storage for the tokens of a BufferedTokenStream (see the compact constructor argument there).
+  ///
+  /// Instead of keeping one heap allocated token object per token, the token fields are copied into
+  /// parallel arrays (type, channel, line, column, start and stop index). Token text is not stored but
+  /// taken from the char stream when asked for, except for tokens whose text was set explicitly (e.g. by
+  /// a lexer action). The tokens handed out to the parser are TokenViews: small read-only objects which
+  /// only know their buffer and index. They are allocated in blocks and stay valid until the buffer is
+  /// cleared or destroyed.
+  class ANTLR4CPP_PUBLIC TokenBuffer {
+  public:
+    class ANTLR4CPP_PUBLIC TokenView : public Token {
+    public:
+      TokenView(const TokenBuffer *buffer, size_t index);
+
+      virtual std::string getText() const override;
+      virtual size_t getType() const override;
+      virtual size_t getLine() const override;
+      virtual size_t getCharPositionInLine() const override;
+      virtual size_t getChannel() const override;
+      virtual size_t getTokenIndex() const override;
+      virtual size_t getStartIndex() const override;
+      virtual size_t getStopIndex() const override;
+      virtual TokenSource *getTokenSource() const override;
+      virtual CharStream *getInputStream() const override;
+      virtual std::string toString() const override;
+
+    private:
+      const TokenBuffer *_buffer;
+      size_t _index;
+    };
+
+    TokenBuffer();
+    TokenBuffer(const TokenBuffer &other) = delete;
+
+    TokenBuffer& operator = (const TokenBuffer &other) = delete;
+
+    /// Copies the given token into the buffer. Its token index becomes the current size of the buffer.
+    void add(const Token *token);
+
+    size_t size() const {
+      return _types.size();
+    }
+
+    Token* get(size_t index) {
+      return &_views[index];
+    }
+
+    size_t getType(size_t index) const {
+      return widen(_types[index]);
+    }
+
+    size_t getChannel(size_t index) const {
+      return widen(_channels[index]);
+    }
+
+    size_t getLine(size_t index) const;
+    size_t getCharPositionInLine(size_t index) const;
+    size_t getStartIndex(size_t index) const;
+    size_t getStopIndex(size_t index) const;
+    std::string getText(size_t index) const;
+    TokenSource* getTokenSource(size_t index) const;
+    CharStream* getInputStream(size_t index) const;
+
+    /// Removes all tokens. Views handed out so far become invalid.
+    void clear();
+
+  private:
+    // INVALID_INDEX (which includes Token::EOF) is stored as the largest 32 bit value.
+    static uint32_t narrow(size_t value);
+
+    static size_t widen(uint32_t value) {
+      return value == std::numeric_limits<uint32_t>::max() ? INVALID_INDEX : value;
+    }
+
+    std::vector<uint32_t> _types;
+    std::vector<uint32_t> _channels;
+    std::vector<uint32_t> _lines;
+    std::vector<uint32_t> _columns;
+    std::vector<size_t> _starts;
+    std::vector<size_t> _stops;
+
+    // Usually all tokens come from the same token source and char stream. Tokens from other sources
+    // and tokens with explicit text are rare, so those are kept in side tables.
+    std::pair<TokenSource *, CharStream *> _source;
+    std::unordered_map<size_t, std::pair<TokenSource *, CharStream *>> _otherSources;
+    std::unordered_map<size_t, std::string> _texts;
+
+    std::deque<TokenView> _views;
+  };
+
+} // namespace antlr4
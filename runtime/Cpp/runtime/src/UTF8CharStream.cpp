@@ -0,0 +1,271 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "Exceptions.h"
+#include "misc/Interval.h"
+#include "IntStream.h"
+
+#include "UTF8CharStream.h"
+
+#include <cstring>
+
+using namespace antlr4;
+
+using misc::Interval;
+
+namespace {
+
+  const size_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+  inline bool isContinuation(char c) {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+  }
+
+}
+
+UTF8CharStream::UTF8CharStream() {
+  setData("", 0);
+}
+
+UTF8CharStream::UTF8CharStream(const char *data, size_t length) {
+  setData(data, length);
+}
+
+UTF8CharStream::UTF8CharStream(const std::string &input) : UTF8CharStream(input.data(), input.size()) {
+}
+
+void UTF8CharStream::setData(const char *data, size_t length) {
+  // Skip the UTF-8 BOM if present.
+  if (length >= 3 && std::memcmp(data, "\xef\xbb\xbf", 3) == 0) {
+    data += 3;
+    length -= 3;
+  }
+  _data = data;
+  _length = length;
+  _size = INVALID_INDEX;
+  _checkpoints.clear();
+  reset();
+}
+
+void UTF8CharStream::reset() {
+  _p = 0;
+  _offset = 0;
+  if (_checkpoints.empty()) {
+    _checkpoints.push_back(0);
+  }
+}
+
+void UTF8CharStream::consume() {
+  if (_offset >= _length) {
+    assert(LA(1) == IntStream::EOF);
+    throw IllegalStateException("cannot consume EOF");
+  }
+
+  advance(_p, _offset);
+}
+
+size_t UTF8CharStream::LA(ssize_t i) {
+  if (i == 0) {
+    return 0; // undefined
+  }
+
+  size_t offset = _offset;
+  if (i > 0) {
+    for (ssize_t k = 1; k < i; ++k) {
+      if (offset >= _length) {
+        return IntStream::EOF;
+      }
+      offset = nextOffset(offset);
+    }
+    if (offset >= _length) {
+      return IntStream::EOF;
+    }
+  } else {
+    for (ssize_t k = 0; k > i; --k) {
+      if (offset == 0) {
+        return IntStream::EOF; // invalid; no char before first char
+      }
+      offset = previousOffset(offset);
+    }
+  }
+
+  return decode(offset);
+}
+
+size_t UTF8CharStream::index() {
+  return _p;
+}
+
+size_t UTF8CharStream::size() {
+  if (_size == INVALID_INDEX) {
+    // Start counting from the furthest known position.
+    size_t index = (_checkpoints.size() - 1) * CHECKPOINT_INTERVAL;
+    size_t offset = _checkpoints.back();
+    if (_p > index) {
+      index = _p;
+      offset = _offset;
+    }
+
+    if (offset < _length) {
+      ++index; // The code point at offset, which might start with a stray continuation byte at offset 0.
+      for (size_t i = offset + 1; i < _length; ++i) {
+        if (!isContinuation(_data[i])) {
+          ++index;
+        }
+      }
+    }
+    _size = index;
+  }
+  return _size;
+}
+
+// Mark/release do nothing. We have entire buffer.
+ssize_t UTF8CharStream::mark() {
+  return -1;
+}
+
+void UTF8CharStream::release(ssize_t /* marker */) {
+}
+
+void UTF8CharStream::seek(size_t index) {
+  if (index == _p) {
+    return;
+  }
+
+  _offset = offsetOf(index);
+  if (_offset >= _length) {
+    // Seeking past the end stops at EOF (like consuming until EOF).
+    _p = std::min(index, size());
+  } else {
+    _p = index;
+  }
+}
+
+std::string UTF8CharStream::getText(const Interval &interval) {
+  std::pair<const char *, size_t> range = getTextRange(interval);
+  return std::string(range.first, range.second);
+}
+
+std::pair<const char *, size_t> UTF8CharStream::getTextRange(const Interval &interval) {
+  if (interval.a < 0 || interval.b < interval.a) {
+    return { _data, 0 };
+  }
+
+  size_t start = offsetOf(static_cast<size_t>(interval.a));
+  if (start >= _length) {
+    return { _data, 0 };
+  }
+
+  // The stop index is inclusive, so the range ends where the next code point starts.
+  size_t stop = offsetOf(static_cast<size_t>(interval.b) + 1);
+  return { _data + start, stop - start };
+}
+
+std::string UTF8CharStream::getSourceName() const {
+  if (name.empty()) {
+    return IntStream::UNKNOWN_SOURCE_NAME;
+  }
+  return name;
+}
+
+std::string UTF8CharStream::toString() const {
+  return std::string(_data, _length);
+}
+
+size_t UTF8CharStream::nextOffset(size_t offset) const {
+  ++offset;
+  while (offset < _length && isContinuation(_data[offset])) {
+    ++offset;
+  }
+  return offset;
+}
+
+size_t UTF8CharStream::previousOffset(size_t offset) const {
+  --offset;
+  while (offset > 0 && isContinuation(_data[offset])) {
+    --offset;
+  }
+  return offset;
+}
+
+size_t UTF8CharStream::decode(size_t offset) const {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(_data + offset);
+  size_t lead = bytes[0];
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  size_t length;
+  size_t codePoint;
+  size_t minimum;
+  if ((lead & 0xE0) == 0xC0) {
+    length = 2;
+    codePoint = lead & 0x1F;
+    minimum = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 3;
+    codePoint = lead & 0x0F;
+    minimum = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    length = 4;
+    codePoint = lead & 0x07;
+    minimum = 0x10000;
+  } else {
+    return REPLACEMENT_CHARACTER; // Stray continuation byte or invalid lead byte.
+  }
+
+  // Must match exactly the extent forward/backward navigation assumes for this code point.
+  if (nextOffset(offset) - offset != length) {
+    return REPLACEMENT_CHARACTER;
+  }
+
+  for (size_t i = 1; i < length; ++i) {
+    codePoint = (codePoint << 6) | (bytes[i] & 0x3F);
+  }
+
+  if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+    return REPLACEMENT_CHARACTER;
+  }
+  return codePoint;
+}
+
+void UTF8CharStream::advance(size_t &index, size_t &offset) {
+  offset = nextOffset(offset);
+  ++index;
+  if (offset < _length && index == _checkpoints.size() * CHECKPOINT_INTERVAL) {
+    _checkpoints.push_back(offset);
+  }
+}
+
+size_t UTF8CharStream::offsetOf(size_t index) {
+  if (index == _p) {
+    return _offset;
+  }
+
+  // Closest checkpoint at or before the index.
+  size_t checkpoint = std::min(index / CHECKPOINT_INTERVAL, _checkpoints.size() - 1);
+  size_t current = checkpoint * CHECKPOINT_INTERVAL;
+  size_t offset = _checkpoints[checkpoint];
+
+  if (_p < index && _p > current) {
+    // The current position is closer than any checkpoint.
+    current = _p;
+    offset = _offset;
+  } else if (_p > index && _p - index < index - current) {
+    // Walking back from the current position is shorter.
+    current = _p;
+    offset = _offset;
+    while (current > index) {
+      offset = previousOffset(offset);
+      --current;
+    }
+    return offset;
+  }
+
+  while (current < index && offset < _length) {
+    advance(current, offset);
+  }
+  return offset;
+}
@@ -0,0 +1,92 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "CharStream.h"
+
+namespace antlr4 {
+
+  /// A char stream working directly on UTF-8 encoded input, without converting it to UTF-32 first.
+  /// The buffer is owned by the caller and must stay alive (and unchanged) as long as the stream is used.
+  ///
+  /// Code points are decoded on the fly in LA() and consume(). Indexes are still code point indexes
+  /// (as in ANTLRInputStream), so tokens are compatible with the other char streams. To map such an index
+  /// back to a byte offset the stream records the byte offset of every CHECKPOINT_INTERVAL'th code point
+  /// while it moves through the input. Seeking and getText() therefore touch at most CHECKPOINT_INTERVAL - 1
+  /// code points and getText() only copies the original bytes, no re-encoding takes place.
+  ///
+  /// Malformed sequences (including overlong forms and surrogates) are returned as U+FFFD. A code point is
+  /// always a lead byte plus all continuation bytes following it, which keeps forward and backward
+  /// navigation consistent for any input.
+  class ANTLR4CPP_PUBLIC UTF8CharStream : public CharStream {
+  public:
+    static const size_t CHECKPOINT_INTERVAL = 64;
+
+    /// What is name or source of this char stream?
+    std::string name;
+
+    /// A leading UTF-8 BOM is skipped.
+    UTF8CharStream(const char *data, size_t length);
+    UTF8CharStream(const std::string &input); // The string is referenced, not copied.
+
+    virtual void reset();
+    virtual void consume() override;
+    virtual size_t LA(ssize_t i) override;
+
+    virtual size_t index() override;
+
+    /// The number of code points in the input. Determined (once) by scanning the rest of the input.
+    virtual size_t size() override;
+
+    /// The number of bytes in the input (without a BOM).
+    size_t byteSize() const {
+      return _length;
+    }
+
+    /// mark/release do nothing; we have the entire buffer.
+    virtual ssize_t mark() override;
+    virtual void release(ssize_t marker) override;
+
+    virtual void seek(size_t index) override;
+    virtual std::string getText(const misc::Interval &interval) override;
+
+    /// Zero-copy variant of getText(). The returned pointer refers to the underlying buffer.
+    std::pair<const char *, size_t> getTextRange(const misc::Interval &interval);
+
+    virtual std::string getSourceName() const override;
+    virtual std::string toString() const override;
+
+  protected:
+    UTF8CharStream();
+
+    /// Sets the buffer to work on (skipping a leading BOM) and resets the stream.
+    void setData(const char *data, size_t length);
+
+  private:
+    const char *_data;
+    size_t _length;
+
+    /// Code point index of LA(1) and its byte offset.
+    size_t _p;
+    size_t _offset;
+
+    /// _checkpoints[k] is the byte offset of code point k * CHECKPOINT_INTERVAL.
+    std::vector<size_t> _checkpoints;
+
+    size_t _size;
+
+    size_t nextOffset(size_t offset) const;
+    size_t previousOffset(size_t offset) const;
+    size_t decode(size_t offset) const;
+
+    /// Moves (index, offset) forward by one code point, recording a checkpoint if a new one is reached.
+    void advance(size_t &index, size_t &offset);
+
+    /// Returns the byte offset of the given code point (or the input length if it lies past the end).
+    size_t offsetOf(size_t index);
+  };
+
+} // namespace antlr4
@@ -13,8 +13,10 @@
 #include "ANTLRErrorStrategy.h"
 #include "ANTLRFileStream.h"
 #include "ANTLRInputStream.h"
+#include "ArenaTokenFactory.h"
 #include "BailErrorStrategy.h"
 #include "BaseErrorListener.h"
+#include "BatchParser.h"
 #include "BufferedTokenStream.h"
 #include "CharStream.h"
 #include "CommonToken.h"
@@ -32,6 +34,7 @@
 #include "LexerInterpreter.h"
 #include "LexerNoViableAltException.h"
 #include "ListTokenSource.h"
+#include "MappedFileStream.h"
 #include "NoViableAltException.h"
 #include "Parser.h"
 #include "ParserInterpreter.h"
@@ -43,10 +46,12 @@
 #include "RuleContextWithAltNum.h"
 #include "RuntimeMetaData.h"
 #include "Token.h"
+#include "TokenBuffer.h"
 #include "TokenFactory.h"
 #include "TokenSource.h"
 #include "TokenStream.h"
 #include "TokenStreamRewriter.h"
+#include "UTF8CharStream.h"
 #include "UnbufferedCharStream.h"
 #include "UnbufferedTokenStream.h"
 #include "Vocabulary.h"
@@ -70,6 +75,7 @@
 #include "atn/BasicState.h"
 #include "atn/BlockEndState.h"
 #include "atn/BlockStartState.h"
+#include "atn/CompiledATN.h"
 #include "atn/ContextSensitivityInfo.h"
 #include "atn/DecisionEventInfo.h"
 #include "atn/DecisionInfo.h"
@@ -77,6 +83,8 @@
 #include "atn/EmptyPredictionContext.h"
 #include "atn/EpsilonTransition.h"
 #include "atn/ErrorInfo.h"
+#include "atn/FollowSetCache.h"
+#include "atn/FullContextCache.h"
 #include "atn/LL1Analyzer.h"
 #include "atn/LexerATNConfig.h"
 #include "atn/LexerATNSimulator.h"
@@ -120,9 +128,12 @@
 #include "atn/Transition.h"
 #include "atn/WildcardTransition.h"
 #include "dfa/DFA.h"
+#include "dfa/DFAEdgeTable.h"
 #include "dfa/DFASerializer.h"
+#include "dfa/DFASnapshot.h"
 #include "dfa/DFAState.h"
 #include "dfa/LexerDFASerializer.h"
+#include "dfa/LexerDFATable.h"
 #include "misc/Interval.h"
 #include "misc/IntervalSet.h"
 #include "misc/MurmurHash.h"
@@ -131,7 +142,10 @@
 #include "support/Arrays.h"
 #include "support/BitSet.h"
 #include "support/CPPUtils.h"
+#include "support/MappedFile.h"
+#include "support/PoolAllocator.h"
 #include "support/StringUtils.h"
+#include "support/Utf8.h"
 #include "support/guid.h"
 #include "tree/AbstractParseTreeVisitor.h"
 #include "tree/ErrorNode.h"
@@ -141,6 +155,7 @@
 #include "tree/ParseTreeProperty.h"
 #include "tree/ParseTreeVisitor.h"
 #include "tree/ParseTreeWalker.h"
+#include "tree/RuleDispatchTable.h"
 #include "tree/TerminalNode.h"
 #include "tree/TerminalNodeImpl.h"
 #include "tree/Trees.h"
@@ -13,6 +13,8 @@
 #include "atn/ATNType.h"
 #include "Exceptions.h"
 #include "support/CPPUtils.h"
+#include "atn/CompiledATN.h"
+#include "atn/FollowSetCache.h"
 
 #include "atn/ATN.h"
 
@@ -20,6 +22,21 @@ using namespace antlr4;
 using namespace antlr4::atn;
 using namespace antlrcpp;
 
+namespace {
+
+  // Collects the invoking states of context and its parents, innermost first. Stops at the first context
+  // without invoking state, or after the first one without parent.
+  std::vector<size_t> getInvokingStates(RuleContext *context) {
+    std::vector<size_t> result;
+    for (RuleContext *ctx = context; ctx != nullptr && ctx->invokingState != ATNState::INVALID_STATE_NUMBER;
+         ctx = static_cast<RuleContext *>(ctx->parent)) {
+      result.push_back(ctx->invokingState);
+    }
+    return result;
+  }
+
+}
+
 ATN::ATN() : ATN(ATNType::LEXER, 0) {
 }
 
@@ -34,6 +51,8 @@ ATN::ATN(ATN &&other) {
   ruleToTokenType = std::move(other.ruleToTokenType);
   lexerActions = std::move(other.lexerActions);
   modeToStartState = std::move(other.modeToStartState);
+  _compiledATN = std::move(other._compiledATN);
+  _followSetCache = std::move(other._followSetCache);
 }
 
 ATN::ATN(ATNType grammarType_, size_t maxTokenType_) : grammarType(grammarType_), maxTokenType(maxTokenType_) {
@@ -58,6 +77,8 @@ ATN& ATN::operator = (ATN &other) NOEXCEPT {
   ruleToTokenType = other.ruleToTokenType;
   lexerActions = other.lexerActions;
   modeToStartState = other.modeToStartState;
+  _compiledATN.reset(); // Created again when needed.
+  _followSetCache.reset();
 
   return *this;
 }
@@ -77,14 +98,34 @@ ATN& ATN::operator = (ATN &&other) NOEXCEPT {
   ruleToTokenType = std::move(other.ruleToTokenType);
   lexerActions = std::move(other.lexerActions);
   modeToStartState = std::move(other.modeToStartState);
+  _compiledATN = std::move(other._compiledATN);
+  _followSetCache = std::move(other._followSetCache);
 
   return *this;
 }
 
 misc::IntervalSet ATN::nextTokens(ATNState *s, RuleContext *ctx) const {
-  LL1Analyzer analyzer(*this);
-  return analyzer.LOOK(s, ctx);
+  if (ctx == nullptr) {
+    LL1Analyzer analyzer(*this);
+    return analyzer.LOOK(s, ctx);
+  }
 
+  // Same as LL1Analyzer::LOOK(s, ctx), but composed from the memoized sets. Like PredictionContext::fromRuleContext
+  // this only follows contexts with a parent.
+  const misc::IntervalSet &following = nextTokens(s);
+  if (!following.contains(Token::EPSILON)) {
+    return following;
+  }
+
+  std::vector<size_t> invokingStates;
+  for (; ctx->parent != nullptr; ctx = static_cast<RuleContext *>(ctx->parent)) {
+    invokingStates.push_back(ctx->invokingState);
+  }
+
+  misc::IntervalSet result(following);
+  result.remove(Token::EPSILON);
+  result.addAll(getFollowSetCache().get(*this, invokingStates).followSet);
+  return result;
 }
 
 misc::IntervalSet& ATN::nextTokens(ATNState *s) const {
@@ -98,6 +139,26 @@ misc::IntervalSet& ATN::nextTokens(ATNState *s) const {
   return s->nextTokenWithinRule;
 }
 
+const misc::IntervalSet& ATN::getErrorRecoverySet(RuleContext *context) const {
+  return getFollowSetCache().get(*this, getInvokingStates(context)).recoverySet;
+}
+
+FollowSetCache& ATN::getFollowSetCache() const {
+  std::unique_lock<std::mutex> lock { _mutex };
+  if (_followSetCache == nullptr) {
+    _followSetCache.reset(new FollowSetCache()); /* mem-check: released with the ATN */
+  }
+  return *_followSetCache;
+}
+
+const CompiledATN& ATN::getCompiledATN() const {
+  std::unique_lock<std::mutex> lock { _mutex };
+  if (_compiledATN == nullptr) {
+    _compiledATN.reset(new CompiledATN(*this)); /* mem-check: released with the ATN */
+  }
+  return *_compiledATN;
+}
+
 void ATN::addState(ATNState *state) {
   if (state != nullptr) {
     //state->atn = this;
@@ -134,33 +195,16 @@ misc::IntervalSet ATN::getExpectedTokens(size_t stateNumber, RuleContext *contex
     throw IllegalArgumentException("Invalid state number.");
   }
 
-  RuleContext *ctx = context;
-  ATNState *s = states.at(stateNumber);
-  misc::IntervalSet following = nextTokens(s);
+  const misc::IntervalSet &following = nextTokens(states.at(stateNumber));
   if (!following.contains(Token::EPSILON)) {
     return following;
   }
 
-  misc::IntervalSet expected;
-  expected.addAll(following);
+  // The cached follow set of the invocation stack contains what the rules further out add and EOF if they can all
+  // end here, so it doesn't need to be walked anymore.
+  misc::IntervalSet expected(following);
   expected.remove(Token::EPSILON);
-  while (ctx && ctx->invokingState != ATNState::INVALID_STATE_NUMBER && following.contains(Token::EPSILON)) {
-    ATNState *invokingState = states.at(ctx->invokingState);
-    RuleTransition *rt = static_cast<RuleTransition*>(invokingState->transitions[0]);
-    following = nextTokens(rt->followState);
-    expected.addAll(following);
-    expected.remove(Token::EPSILON);
-
-    if (ctx->parent == nullptr) {
-      break;
-    }
-    ctx = (RuleContext *)ctx->parent;
-  }
-
-  if (following.contains(Token::EPSILON)) {
-    expected.add(Token::EOF);
-  }
-
+  expected.addAll(getFollowSetCache().get(*this, getInvokingStates(context)).followSet);
   return expected;
 }
 
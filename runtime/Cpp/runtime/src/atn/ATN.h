@@ -102,10 +102,23 @@ namespace atn {
     /// number {@code stateNumber} </exception>
     virtual misc::IntervalSet getExpectedTokens(size_t stateNumber, RuleContext *context) const;
 
+    /// Returns the union of the tokens which can follow each rule invocation on the stack of {@code context},
+    /// as DefaultErrorStrategy uses it to resynchronize after an error. Memoized per invocation stack.
+    const misc::IntervalSet& getErrorRecoverySet(RuleContext *context) const;
+
+    /// Returns the memoized context dependent token sets, which are created on first use.
+    FollowSetCache& getFollowSetCache() const;
+
+    /// Returns the flat representation of this ATN used by the simulators. It is created on first use,
+    /// so the ATN must not be modified anymore once a simulator was created for it.
+    const CompiledATN& getCompiledATN() const;
+
     std::string toString() const;
 
   private:
     mutable std::mutex _mutex;
+    mutable std::unique_ptr<CompiledATN> _compiledATN;
+    mutable std::unique_ptr<FollowSetCache> _followSetCache;
   };
 
 } // namespace atn
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "support/PoolAllocator.h"
+
 namespace antlr4 {
 namespace atn {
 
@@ -88,10 +90,11 @@ namespace atn {
     /// Can be shared between multiple ATNConfig instances.
     Ref<SemanticContext> semanticContext;
 
+    // Configurations are created and dropped in large numbers during closure, so they live in the object pool.
     template <class... _Types>
     static Ref<ATNConfig> create(_Types&&... _Args)
       {
-      return std::make_shared<ATNConfig>(_Args...);
+      return antlrcpp::makePooled<ATNConfig>(std::forward<_Types>(_Args)...);
       }
 
     ATNConfig(ATNState *state, size_t alt, Ref<PredictionContext> const& context);
@@ -19,6 +19,8 @@ namespace
 {
 const size_t s = sizeof(ATNConfigSet);
 const size_t s1 = sizeof(antlrcpp::BitSet);
+
+const size_t INITIAL_LOOKUP_CAPACITY = 16;
 }
 
 ATNConfigSet::ATNConfigSet(bool fullCtx) : fullCtx(fullCtx) {
@@ -51,10 +53,8 @@ bool ATNConfigSet::add(const Ref<ATNConfig> &config, PredictionContextMergeCache
     dipsIntoOuterContext = true;
   }
 
-  size_t hash = getHash(config.get());
-  ATNConfig *existing = _configLookup[hash];
+  ATNConfig *existing = findOrAdd(config.get());
   if (existing == nullptr) {
-    _configLookup[hash] = config.get();
     _cachedHashCode = 0;
     configs.push_back(config); // track order here
 
@@ -129,7 +129,7 @@ void ATNConfigSet::optimizeConfigs(ATNSimulator *interpreter) {
   if (_readonly) {
     throw IllegalStateException("This set is readonly");
   }
-  if (_configLookup.empty())
+  if (_lookupCount == 0)
     return;
 
   for (auto &config : configs) {
@@ -217,7 +217,8 @@ void ATNConfigSet::clear() {
   }
   configs.clear();
   _cachedHashCode = 0;
-  _configLookup.clear();
+  _lookupCount = 0;
+  ++_lookupGeneration;
 }
 
 bool ATNConfigSet::isReadonly() {
@@ -226,7 +227,11 @@ bool ATNConfigSet::isReadonly() {
 
 void ATNConfigSet::setReadonly(bool readonly) {
   _readonly = readonly;
-  _configLookup.clear();
+
+  // The set now becomes part of a DFA state and stays around, so release the lookup memory.
+  std::vector<LookupEntry>().swap(_configLookup);
+  _lookupCount = 0;
+  _lookupShift = 0;
 }
 
 std::string ATNConfigSet::toString() {
@@ -263,6 +268,66 @@ size_t ATNConfigSet::getHash(ATNConfig *c) {
   return hashCode;
 }
 
+bool ATNConfigSet::isSameConfig(ATNConfig *lhs, ATNConfig *rhs) {
+  return lhs->state->stateNumber == rhs->state->stateNumber && lhs->alt == rhs->alt &&
+    (lhs->semanticContext == rhs->semanticContext || *lhs->semanticContext == *rhs->semanticContext);
+}
+
+ATNConfig* ATNConfigSet::findOrAdd(ATNConfig *config) {
+  // Keep the load factor at or below 1/2, which keeps probe sequences short.
+  if (2 * (_lookupCount + 1) > _configLookup.size()) {
+    rehash(_configLookup.empty() ? INITIAL_LOOKUP_CAPACITY : 2 * _configLookup.size());
+  }
+
+  size_t hash = getHash(config);
+  size_t mask = _configLookup.size() - 1;
+  for (size_t slot = lookupSlot(hash); ; slot = (slot + 1) & mask) {
+    LookupEntry &entry = _configLookup[slot];
+    if (entry.generation != _lookupGeneration) {
+      entry.hash = hash;
+      entry.config = config;
+      entry.generation = _lookupGeneration;
+      ++_lookupCount;
+      return nullptr;
+    }
+
+    if (entry.hash == hash && (entry.config == config || isSameConfig(entry.config, config))) {
+      return entry.config;
+    }
+  }
+}
+
+void ATNConfigSet::rehash(size_t capacity) {
+  std::vector<LookupEntry> old;
+  old.swap(_configLookup);
+  _configLookup.resize(capacity, { 0, nullptr, 0 });
+
+  _lookupShift = 64;
+  for (size_t size = capacity; size > 1; size >>= 1) {
+    --_lookupShift;
+  }
+
+  // Entries of older generations can be left behind, which leaves generation 0 free to mark empty slots.
+  size_t generation = _lookupGeneration;
+  _lookupGeneration = 1;
+  size_t mask = capacity - 1;
+  for (auto &entry : old) {
+    if (entry.generation == generation) {
+      size_t slot = lookupSlot(entry.hash);
+      while (_configLookup[slot].generation == _lookupGeneration) {
+        slot = (slot + 1) & mask;
+      }
+      _configLookup[slot] = entry;
+      _configLookup[slot].generation = _lookupGeneration;
+    }
+  }
+}
+
+size_t ATNConfigSet::lookupSlot(size_t hash) const {
+  // Fibonacci hashing. The config hashes are not well distributed in their low bits.
+  return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> _lookupShift);
+}
+
 void ATNConfigSet::InitializeInstanceFields() {
   uniqueAlt = 0;
   hasSemanticContext = false;
@@ -270,4 +335,8 @@ void ATNConfigSet::InitializeInstanceFields() {
 
   _readonly = false;
   _cachedHashCode = 0;
+
+  _lookupCount = 0;
+  _lookupGeneration = 1;
+  _lookupShift = 0;
 }
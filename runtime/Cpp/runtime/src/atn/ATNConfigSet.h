@@ -105,12 +105,32 @@ namespace atn {
 
     virtual size_t getHash(ATNConfig *c); // Hash differs depending on set type.
 
+    /// Determines if two configs must be merged into one. Must be consistent with getHash().
+    virtual bool isSameConfig(ATNConfig *lhs, ATNConfig *rhs);
+
   private:
+    struct LookupEntry {
+      size_t hash;
+      ATNConfig *config;
+      size_t generation; // The entry is only in use if this matches _lookupGeneration.
+    };
+
     size_t _cachedHashCode;
 
     /// All configs but hashed by (s, i, _, pi) not including context. Wiped out
     /// when we go readonly as this set becomes a DFA state.
-    std::map<size_t, ATNConfig *> _configLookup;
+    /// This is an open addressing hash table (linear probing, power of 2 size). Clearing it only
+    /// increments the generation, so the table can be reused without touching its memory.
+    std::vector<LookupEntry> _configLookup;
+    size_t _lookupCount;
+    size_t _lookupGeneration;
+    size_t _lookupShift;
+
+    /// Returns the config in the lookup which matches the given one. If there is none, config is added
+    /// to the lookup and nullptr is returned.
+    ATNConfig* findOrAdd(ATNConfig *config);
+    void rehash(size_t capacity);
+    size_t lookupSlot(size_t hash) const;
 
     void InitializeInstanceFields();
   };
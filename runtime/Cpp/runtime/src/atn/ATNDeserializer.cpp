@@ -156,10 +156,14 @@ bool ATNDeserializer::isFeatureSupported(const Guid &feature, const Guid &actual
 }
 
 ATN ATNDeserializer::deserialize(const std::vector<uint16_t>& input) {
+  return deserialize(input.data(), input.size());
+}
+
+ATN ATNDeserializer::deserialize(const uint16_t *input, size_t length) {
   // Don't adjust the first value since that's the version number.
-  std::vector<uint16_t> data(input.size());
+  std::vector<uint16_t> data(length);
   data[0] = input[0];
-  for (size_t i = 1; i < input.size(); ++i) {
+  for (size_t i = 1; i < length; ++i) {
     data[i] = input[i] - 2;
   }
 
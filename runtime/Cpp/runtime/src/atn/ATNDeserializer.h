@@ -26,6 +26,10 @@ namespace atn {
     static Guid toUUID(const unsigned short *data, size_t offset);
 
     virtual ATN deserialize(const std::vector<uint16_t> &input);
+
+    /// Deserializes directly from a constant array, as emitted by the code generator, without copying it into a
+    /// vector first.
+    ATN deserialize(const uint16_t *input, size_t length);
     virtual void verifyATN(const ATN &atn);
 
     static void checkCondition(bool condition);
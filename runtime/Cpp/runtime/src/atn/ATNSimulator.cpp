@@ -8,6 +8,7 @@
 #include "dfa/DFAState.h"
 #include "atn/ATNDeserializer.h"
 #include "atn/EmptyPredictionContext.h"
+#include "atn/CompiledATN.h"
 
 #include "atn/ATNSimulator.h"
 
@@ -16,11 +17,9 @@ using namespace antlr4::dfa;
 using namespace antlr4::atn;
 
 const Ref<DFAState> ATNSimulator::ERROR = std::make_shared<DFAState>(INT32_MAX);
-antlrcpp::SingleWriteMultipleReadLock ATNSimulator::_stateLock;
-antlrcpp::SingleWriteMultipleReadLock ATNSimulator::_edgeLock;
 
 ATNSimulator::ATNSimulator(const ATN &atn, PredictionContextCache &sharedContextCache)
-: atn(atn), _sharedContextCache(sharedContextCache) {
+: atn(atn), _sharedContextCache(sharedContextCache), _compiledATN(atn.getCompiledATN()) {
 }
 
 ATNSimulator::~ATNSimulator() {
@@ -30,12 +29,76 @@ void ATNSimulator::clearDFA() {
   throw UnsupportedOperationException("This ATN simulator does not support clearing the DFA.");
 }
 
+bool ATNSimulator::purgeIfOverCapacity() {
+  if (!_sharedContextCache.isOverCapacity()) {
+    return false;
+  }
+
+  clearDFA();
+  _sharedContextCache.clear();
+  return true;
+}
+
+std::vector<dfa::DFA>& ATNSimulator::getDecisionToDFA() {
+  throw UnsupportedOperationException("This ATN simulator has no DFA.");
+}
+
+std::vector<dfa::DFA::Statistics> ATNSimulator::getDFAStatistics() {
+  std::vector<dfa::DFA::Statistics> result;
+  for (const dfa::DFA &dfa : getDecisionToDFA()) {
+    result.push_back(dfa.getStatistics());
+  }
+  return result;
+}
+
+size_t ATNSimulator::trimDFA(size_t budget) {
+  std::vector<dfa::DFA> &decisionToDFA = getDecisionToDFA();
+  std::vector<dfa::DFA::Statistics> statistics = getDFAStatistics();
+  dfa::DFA::advanceUseEpoch();
+
+  size_t total = 0;
+  for (auto &entry : statistics) {
+    total += entry.bytes;
+  }
+
+  if (total > budget) {
+    for (auto &entry : statistics) {
+      size_t released = decisionToDFA[entry.decision].releaseConfigs();
+      entry.bytes -= released;
+      total -= released;
+    }
+  }
+
+  if (total > budget) {
+    // Coldest first, and among equally cold ones the largest.
+    std::sort(statistics.begin(), statistics.end(), [](const dfa::DFA::Statistics &lhs,
+      const dfa::DFA::Statistics &rhs) {
+      if (lhs.lastUse != rhs.lastUse) {
+        return lhs.lastUse < rhs.lastUse;
+      }
+      return lhs.bytes > rhs.bytes;
+    });
+
+    for (auto &entry : statistics) {
+      if (total <= budget) {
+        break;
+      }
+
+      dfa::DFA &dfa = decisionToDFA[entry.decision];
+      dfa.clear();
+      total -= entry.bytes;
+      total += dfa.getStatistics().bytes; // What an empty DFA still takes.
+    }
+  }
+
+  return total;
+}
+
 PredictionContextCache& ATNSimulator::getSharedContextCache() {
   return _sharedContextCache;
 }
 
 Ref<PredictionContext> ATNSimulator::getCachedContext(Ref<PredictionContext> const& context) {
-  // This function must only be called with an active state lock, as we are going to change a shared structure.
   std::map<Ref<PredictionContext>, Ref<PredictionContext>> visited;
   return PredictionContext::getCachedContext(context, _sharedContextCache, visited);
 }
@@ -9,6 +9,7 @@
 #include "misc/IntervalSet.h"
 #include "support/CPPUtils.h"
 #include "atn/PredictionContext.h"
+#include "dfa/DFA.h"
 
 namespace antlr4 {
 namespace atn {
@@ -36,6 +37,32 @@ namespace atn {
      * @since 4.3
      */
     virtual void clearDFA();
+
+    /// Clears the DFA together with the shared context cache if the cache has grown beyond its capacity (see
+    /// PredictionContextCache::setCapacity) and returns true in that case. Both have to go at the same time: the
+    /// DFA states hold on to the cached contexts, so clearing only the cache would free nothing, and clearing only
+    /// the DFA would keep contexts alive which no state uses anymore.
+    ///
+    /// Like clearDFA(), this must only be called while no other thread predicts with the same DFA, e.g. between
+    /// two parse runs.
+    virtual bool purgeIfOverCapacity();
+
+    /// The DFAs of all decisions (or lexer modes), which all simulators of a grammar share.
+    /// @throws UnsupportedOperationException if the current instance has no DFA.
+    virtual std::vector<dfa::DFA>& getDecisionToDFA();
+
+    /// Memory statistics of the DFA, per decision.
+    std::vector<dfa::DFA::Statistics> getDFAStatistics();
+
+    /// Brings the estimated memory use of the DFA down to the given budget (in bytes) if it is above. First the
+    /// configs which prediction doesn't need anymore are released (see DFA::releaseConfigs()). If that is not
+    /// enough, the DFAs of the decisions which were not used for the longest time are cleared, larger ones first.
+    /// Returns the memory use afterwards. Every call starts a new use epoch (see DFA::markUsed()), so the next
+    /// one knows which decisions were used in between.
+    ///
+    /// Like clearDFA(), this must only be called while no other thread predicts with the same DFA.
+    size_t trimDFA(size_t budget);
+
     virtual PredictionContextCache& getSharedContextCache();
     virtual Ref<PredictionContext> getCachedContext(Ref<PredictionContext> const& context);
 
@@ -56,9 +83,6 @@ namespace atn {
     static ATNState *stateFactory(int type, int ruleIndex);
 
   protected:
-    static antlrcpp::SingleWriteMultipleReadLock _stateLock; // Lock for DFA states.
-    static antlrcpp::SingleWriteMultipleReadLock _edgeLock; // Lock for the sparse edge map in DFA states.
-
     /// <summary>
     /// The context cache maps all PredictionContext objects that are equals()
     ///  to a single cached copy. This cache is shared across all contexts
@@ -81,6 +105,9 @@ namespace atn {
     ///  so it's not worth the complexity.
     /// </summary>
     PredictionContextCache &_sharedContextCache;
+
+    /// The flat form of atn, used in the closure and reach loops.
+    const CompiledATN &_compiledATN;
   };
 
 } // namespace atn
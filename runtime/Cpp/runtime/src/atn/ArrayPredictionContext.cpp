@@ -4,6 +4,7 @@
  */
 
 #include "support/Arrays.h"
+#include "support/PoolAllocator.h"
 #include "atn/SingletonPredictionContext.h"
 
 #include "atn/ArrayPredictionContext.h"
@@ -220,7 +221,7 @@ class TBuilder final : public ABuilder
       typedef StaticArrayPredictionContext<ParentSize, ReturnStateSize> TStorage;
       typedef ArrayPredictionContextImpl<TStorage> TPredictionContextImpl;
 
-      return std::make_shared<TPredictionContextImpl>(
+      return antlrcpp::makePooled<TPredictionContextImpl>(
         std::move(parents), std::move(returnStates), cachedHashCode);
       }
   };
@@ -237,7 +238,7 @@ class TBuilder<0, 0> final : public ABuilder
       maxMaxParents = std::max(maxMaxParents, parents.size());
       maxReturnStates  = std::max(maxReturnStates, returnStates.size());
 
-      return std::make_shared<TPredictionContextImpl>(
+      return antlrcpp::makePooled<TPredictionContextImpl>(
         std::move(parents), std::move(returnStates), cachedHashCode);
       }
 
@@ -364,7 +365,7 @@ Ref<ArrayPredictionContext> ArrayPredictionContext::makePredictionContext(
   typedef ArrayPredictionContextImpl<TStorage> TPredictionContextImpl;
 
   size_t hashCode = calculateHashCode(parent->parent, parent->returnState);
-  return std::make_shared<TPredictionContextImpl>(parent->parent,
+  return antlrcpp::makePooled<TPredictionContextImpl>(parent->parent,
     parent->returnState, hashCode);
   }
 
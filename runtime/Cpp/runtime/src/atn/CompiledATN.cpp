@@ -0,0 +1,158 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "Lexer.h"
+#include "atn/ATN.h"
+#include "atn/ATNType.h"
+#include "atn/AtomTransition.h"
+#include "atn/RangeTransition.h"
+#include "atn/SetTransition.h"
+#include "atn/EpsilonTransition.h"
+
+#include "atn/CompiledATN.h"
+
+using namespace antlr4::atn;
+
+CompiledATN::CompiledATN(const ATN &atn) : _charClassCount(0) {
+  size_t transitionCount = 0;
+  for (ATNState *state : atn.states) {
+    if (state != nullptr) {
+      transitionCount += state->transitions.size();
+    }
+  }
+
+  _states.reserve(atn.states.size());
+  _transitions.reserve(transitionCount);
+
+  for (ATNState *state : atn.states) {
+    State compiledState = { ATNState::ATN_INVALID_TYPE, false, _transitions.size(), 0 };
+    if (state == nullptr) {
+      _states.push_back(compiledState);
+      continue;
+    }
+
+    compiledState.type = state->getStateType();
+    compiledState.epsilonOnlyTransitions = state->epsilonOnlyTransitions;
+    compiledState.transitionCount = state->transitions.size();
+    _states.push_back(compiledState);
+
+    for (Transition *t : state->transitions) {
+      CompiledTransition compiled = { t->getSerializationType(), t->isEpsilon(), t->target, 0, 0, nullptr, t };
+      switch (compiled.type) {
+        case Transition::ATOM:
+          compiled.from = compiled.to = static_cast<AtomTransition *>(t)->_label;
+          break;
+
+        case Transition::RANGE:
+          compiled.from = static_cast<RangeTransition *>(t)->from;
+          compiled.to = static_cast<RangeTransition *>(t)->to;
+          break;
+
+        case Transition::SET:
+        case Transition::NOT_SET:
+          compiled.set = &static_cast<SetTransition *>(t)->set;
+          break;
+
+        case Transition::EPSILON:
+          compiled.from = static_cast<EpsilonTransition *>(t)->outermostPrecedenceReturn();
+          break;
+
+        default:
+          break;
+      }
+      _transitions.push_back(compiled);
+    }
+  }
+
+  if (atn.grammarType == ATNType::LEXER) {
+    buildCharClasses();
+  }
+}
+
+void CompiledATN::buildCharClasses() {
+  const size_t maxCodePoint = Lexer::MAX_CHAR_VALUE;
+
+  // The distinct labels of all transitions, clipped to the classified range. Wildcards match everything,
+  // and a NOT_SET splits the code points exactly like its set.
+  std::map<std::vector<std::pair<size_t, size_t>>, size_t> labelIds;
+  std::vector<const std::vector<std::pair<size_t, size_t>> *> labels;
+  std::vector<std::pair<size_t, size_t>> intervals;
+  auto addInterval = [&](size_t from, size_t to) {
+    from = std::max(from, CHAR_CLASS_MIN);
+    to = std::min(to, maxCodePoint);
+    if (from <= to) {
+      intervals.push_back({ from, to });
+    }
+  };
+
+  for (auto &transition : _transitions) {
+    intervals.clear();
+    switch (transition.type) {
+      case Transition::ATOM:
+      case Transition::RANGE:
+        addInterval(transition.from, transition.to);
+        break;
+
+      case Transition::SET:
+      case Transition::NOT_SET:
+        for (auto &interval : transition.set->getIntervals()) {
+          if (interval.b >= 0) {
+            addInterval(static_cast<size_t>(std::max<ssize_t>(interval.a, 0)), static_cast<size_t>(interval.b));
+          }
+        }
+        break;
+
+      default:
+        break;
+    }
+
+    if (!intervals.empty()) {
+      auto result = labelIds.insert({ intervals, labels.size() });
+      if (result.second) {
+        labels.push_back(&result.first->first);
+      }
+    }
+  }
+
+  // Split the range at every interval boundary.
+  std::vector<size_t> starts = { CHAR_CLASS_MIN };
+  for (auto label : labels) {
+    for (auto &interval : *label) {
+      starts.push_back(interval.first);
+      if (interval.second < maxCodePoint) {
+        starts.push_back(interval.second + 1);
+      }
+    }
+  }
+  std::sort(starts.begin(), starts.end());
+  starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+
+  // Each segment is either completely inside or completely outside of every label. Segments in the same
+  // labels form one class.
+  size_t words = (labels.size() + 63) / 64;
+  std::vector<std::vector<uint64_t>> membership(starts.size(), std::vector<uint64_t>(words, 0));
+  for (size_t labelIndex = 0; labelIndex < labels.size(); ++labelIndex) {
+    for (auto &interval : *labels[labelIndex]) {
+      size_t segment = static_cast<size_t>(std::lower_bound(starts.begin(), starts.end(), interval.first) - starts.begin());
+      for (; segment < starts.size() && starts[segment] <= interval.second; ++segment) {
+        membership[segment][labelIndex / 64] |= uint64_t(1) << (labelIndex % 64);
+      }
+    }
+  }
+
+  std::map<std::vector<uint64_t>, size_t> classIds;
+  for (size_t segment = 0; segment < starts.size(); ++segment) {
+    auto result = classIds.insert({ membership[segment], classIds.size() });
+    size_t charClass = result.first->second;
+    if (result.second) {
+      _classMembers.push_back(starts[segment]);
+    }
+    if (_segmentClasses.empty() || _segmentClasses.back() != charClass) {
+      _segmentStarts.push_back(starts[segment]);
+      _segmentClasses.push_back(charClass);
+    }
+  }
+  _charClassCount = classIds.size();
+}
@@ -0,0 +1,127 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "atn/ATNState.h"
+#include "atn/Transition.h"
+#include "misc/IntervalSet.h"
+
+namespace antlr4 {
+namespace atn {
+
+  /// A flat, read-only copy of the parts of an ATN which the simulators need in their inner loops.
+  ///
+  /// All states and transitions are stored in two contiguous arrays, indexed by state number. Their kinds are
+  /// plain enum values (ATNState::RULE_STOP, Transition::ATOM etc.), so the simulators can use a switch instead
+  /// of virtual calls and dynamic casts. Each compiled transition keeps a pointer to its original Transition
+  /// object, for everything which is not hot (predicates, actions, rule transitions).
+  ///
+  /// Obtained from {@link ATN#getCompiledATN}, which builds it once. The ATN object graph stays as it is.
+  ///
+  /// For lexer ATNs it also partitions the code points from CHAR_CLASS_MIN up into character classes: code points
+  /// in the same class match exactly the same transitions (they are in the same sets, ranges etc.), so the lexer
+  /// can store one DFA edge for a whole class. The classes are merged by membership, not just by range, e.g. all
+  /// letters form a single class if the grammar only ever uses them together.
+  class ANTLR4CPP_PUBLIC CompiledATN {
+  public:
+    /// The first code point with a character class. Below that the lexer indexes DFA edges by code point.
+    static const size_t CHAR_CLASS_MIN = 128;
+
+    struct State {
+      size_t type; // One of the ATNState type constants (ATNState::ATN_INVALID_TYPE for removed states).
+      bool epsilonOnlyTransitions;
+      size_t firstTransition; // Index into the transition array.
+      size_t transitionCount;
+    };
+
+    struct CompiledTransition {
+      Transition::SerializationType type;
+      bool isEpsilon;
+      ATNState *target;
+
+      // ATOM: both are the label. RANGE: the bounds. EPSILON: from is the outermost precedence return.
+      size_t from;
+      size_t to;
+
+      const misc::IntervalSet *set; // SET and NOT_SET only.
+      Transition *transition;
+    };
+
+    CompiledATN(const ATN &atn);
+    CompiledATN(const CompiledATN &other) = delete;
+
+    CompiledATN& operator = (const CompiledATN &other) = delete;
+
+    const State& getState(size_t stateNumber) const {
+      return _states[stateNumber];
+    }
+
+    bool isRuleStopState(const ATNState *state) const {
+      return _states[state->stateNumber].type == ATNState::RULE_STOP;
+    }
+
+    const CompiledTransition* transitionsBegin(const State &state) const {
+      return _transitions.data() + state.firstTransition;
+    }
+
+    const CompiledTransition* transitionsEnd(const State &state) const {
+      return _transitions.data() + state.firstTransition + state.transitionCount;
+    }
+
+    /// The character class of a code point in [CHAR_CLASS_MIN, Lexer::MAX_CHAR_VALUE]. Lexer ATNs only.
+    size_t getCharClass(size_t codePoint) const {
+      // The segment which starts at or before the code point.
+      auto next = std::upper_bound(_segmentStarts.begin(), _segmentStarts.end(), codePoint);
+      return _segmentClasses[static_cast<size_t>(next - _segmentStarts.begin()) - 1];
+    }
+
+    /// The number of character classes (0 for parser ATNs).
+    size_t getCharClassCount() const {
+      return _charClassCount;
+    }
+
+    /// The smallest code point in the given character class.
+    size_t getCharClassMember(size_t charClass) const {
+      return _classMembers[charClass];
+    }
+
+    /// Same as Transition::matches(), without the virtual call.
+    static bool matches(const CompiledTransition &transition, size_t symbol, size_t minVocabSymbol, size_t maxVocabSymbol) {
+      switch (transition.type) {
+        case Transition::ATOM:
+        case Transition::RANGE:
+          return symbol >= transition.from && symbol <= transition.to;
+
+        case Transition::SET:
+          return transition.set->contains(symbol);
+
+        case Transition::NOT_SET:
+          return symbol >= minVocabSymbol && symbol <= maxVocabSymbol && !transition.set->contains(symbol);
+
+        case Transition::WILDCARD:
+          return symbol >= minVocabSymbol && symbol <= maxVocabSymbol;
+
+        default:
+          return false;
+      }
+    }
+
+  private:
+    std::vector<State> _states;
+    std::vector<CompiledTransition> _transitions;
+
+    // Sorted starts of the code point segments and the class of each segment. Adjacent segments have
+    // different classes.
+    std::vector<size_t> _segmentStarts;
+    std::vector<size_t> _segmentClasses;
+    std::vector<size_t> _classMembers;
+    size_t _charClassCount;
+
+    void buildCharClasses();
+  };
+
+} // namespace atn
+} // namespace antlr4
@@ -0,0 +1,49 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "Token.h"
+#include "atn/ATN.h"
+#include "atn/ATNState.h"
+#include "atn/RuleTransition.h"
+
+#include "atn/FollowSetCache.h"
+
+using namespace antlr4;
+using namespace antlr4::atn;
+
+FollowSetCache::FollowSetCache() {
+  // Leaving the outermost rule means the end of the input.
+  _root.followSet.add(Token::EOF);
+}
+
+FollowSetCache::~FollowSetCache() {
+}
+
+const FollowSetCache::Entry& FollowSetCache::get(const ATN &atn, const std::vector<size_t> &invokingStates) {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // Walk from the outermost invocation in, creating missing entries on the way.
+  Node *node = &_root;
+  for (auto iterator = invokingStates.rbegin(); iterator != invokingStates.rend(); ++iterator) {
+    std::unique_ptr<Node> &child = node->children[*iterator];
+    if (child == nullptr) {
+      RuleTransition *transition = static_cast<RuleTransition *>(atn.states[*iterator]->transitions[0]);
+      const misc::IntervalSet &follow = atn.nextTokens(transition->followState);
+
+      child.reset(new Node()); /* mem-check: managed by unique_ptr */
+      child->followSet = follow;
+      if (follow.contains(Token::EPSILON)) {
+        child->followSet.remove(Token::EPSILON);
+        child->followSet.addAll(node->followSet);
+      }
+      child->recoverySet = follow;
+      child->recoverySet.remove(Token::EPSILON);
+      child->recoverySet.addAll(node->recoverySet);
+    }
+    node = child.get();
+  }
+
+  return *node;
+}
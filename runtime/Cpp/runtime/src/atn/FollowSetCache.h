@@ -0,0 +1,55 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "misc/IntervalSet.h"
+
+namespace antlr4 {
+namespace atn {
+
+  /// Memoizes the token sets which depend on the rule invocation stack of a parser: what can follow the current
+  /// rule in its full context (for ATN::getExpectedTokens and ATN::nextTokens(s, ctx)) and the error recovery
+  /// set (for DefaultErrorStrategy). Error recovery needs them for every syntax error and for every sync() in a
+  /// loop with bad input, and computing them walked the whole stack (or ran the LL1Analyzer) each time.
+  ///
+  /// A stack is identified by its chain of invoking states. The entries form a tree rooted at the empty stack,
+  /// so an entry is computed from its parent entry plus the FOLLOW set of one invocation, which in turn is the
+  /// context independent ATN::nextTokens(s) of its follow state (cached in the ATN states).
+  ///
+  /// Obtained from {@link ATN#getFollowSetCache}. Thread safe, entries are never removed while the ATN lives.
+  class ANTLR4CPP_PUBLIC FollowSetCache {
+  public:
+    struct Entry {
+      /// The tokens which can follow the innermost rule invocation, looking further out as long as the rules
+      /// can end without consuming a token. Contains Token::EOF if the outermost rule can be left that way,
+      /// but never Token::EPSILON.
+      misc::IntervalSet followSet;
+
+      /// The union of the tokens which can follow any of the rule invocations, without Token::EPSILON.
+      misc::IntervalSet recoverySet;
+    };
+
+    FollowSetCache();
+    FollowSetCache(const FollowSetCache &other) = delete;
+    ~FollowSetCache();
+
+    FollowSetCache& operator = (const FollowSetCache &other) = delete;
+
+    /// Returns the entry for the given invoking states, innermost invocation first. The reference stays valid
+    /// as long as the cache.
+    const Entry& get(const ATN &atn, const std::vector<size_t> &invokingStates);
+
+  private:
+    struct Node : Entry {
+      std::unordered_map<size_t, std::unique_ptr<Node>> children;
+    };
+
+    std::mutex _mutex;
+    Node _root;
+  };
+
+} // namespace atn
+} // namespace antlr4
@@ -0,0 +1,152 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "RuleContext.h"
+#include "Token.h"
+#include "TokenStream.h"
+#include "atn/ATN.h"
+#include "misc/MurmurHash.h"
+
+#include "atn/FullContextCache.h"
+
+using namespace antlr4;
+using namespace antlr4::atn;
+
+//------------------ Statistics ----------------------------------------------------------------------------------------
+
+double FullContextCache::Statistics::hitRate() const {
+  return lookups > 0 ? static_cast<double>(hits) / lookups : 0;
+}
+
+//------------------ FullContextCache ----------------------------------------------------------------------------------
+
+FullContextCache::Node::Node() : prediction(ATN::INVALID_ALT_NUMBER) {
+}
+
+size_t FullContextCache::KeyHasher::operator () (const Key &key) const {
+  size_t hash = misc::MurmurHash::initialize();
+  for (size_t value : key) {
+    hash = misc::MurmurHash::update(hash, value);
+  }
+  return misc::MurmurHash::finish(hash, key.size());
+}
+
+FullContextCache::FullContextCache(size_t maxNodes) : _maxNodes(maxNodes) {
+  _statistics = { 0, 0, 0, 0, 0, 0 };
+}
+
+FullContextCache::~FullContextCache() {
+}
+
+FullContextCache::Key FullContextCache::getKey(size_t decision, RuleContext *outerContext) {
+  // The same contexts as PredictionContext::fromRuleContext() uses for the prediction.
+  Key key;
+  key.push_back(decision);
+  for (RuleContext *context = outerContext; context != nullptr && context->parent != nullptr;
+       context = static_cast<RuleContext *>(context->parent)) {
+    key.push_back(context->invokingState);
+  }
+  return key;
+}
+
+size_t FullContextCache::lookup(const Key &key, TokenStream *input, size_t startIndex) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  ++_statistics.lookups;
+
+  auto iterator = _roots.find(key);
+  if (iterator == _roots.end() || !iterator->second.cacheable) {
+    return ATN::INVALID_ALT_NUMBER;
+  }
+
+  // Step through the input like ParserATNSimulator::execATNWithFullContext().
+  input->seek(startIndex);
+  size_t t = input->LA(1);
+  const Node *node = &iterator->second.node;
+  while (true) {
+    auto child = node->children.find(t);
+    if (child == node->children.end()) {
+      return ATN::INVALID_ALT_NUMBER;
+    }
+    node = child->second.get();
+    if (node->prediction != ATN::INVALID_ALT_NUMBER) {
+      ++_statistics.hits;
+      return node->prediction;
+    }
+
+    if (t != Token::EOF) {
+      input->consume();
+      t = input->LA(1);
+    }
+  }
+}
+
+void FullContextCache::add(const Key &key, const std::vector<size_t> &lookahead, size_t prediction) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_statistics.nodeCount + lookahead.size() + 1 > _maxNodes) {
+    reset();
+    ++_statistics.clearCount;
+  }
+
+  auto iterator = _roots.find(key);
+  if (iterator == _roots.end()) {
+    iterator = _roots.emplace(key, Root()).first;
+    iterator->second.cacheable = true;
+    ++_statistics.nodeCount;
+  } else if (!iterator->second.cacheable) {
+    return;
+  }
+
+  Node *node = &iterator->second.node;
+  for (size_t t : lookahead) {
+    std::unique_ptr<Node> &child = node->children[t];
+    if (child == nullptr) {
+      child.reset(new Node()); /* mem-check: managed by unique_ptr */
+      ++_statistics.nodeCount;
+    }
+    node = child.get();
+  }
+
+  if (node->prediction == ATN::INVALID_ALT_NUMBER) {
+    node->prediction = prediction;
+    ++_statistics.predictions;
+  }
+}
+
+void FullContextCache::setUncacheable(const Key &key) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  auto iterator = _roots.find(key);
+  if (iterator == _roots.end()) {
+    if (_statistics.nodeCount + 1 > _maxNodes) {
+      reset();
+      ++_statistics.clearCount;
+    }
+    iterator = _roots.emplace(key, Root()).first;
+    ++_statistics.nodeCount;
+  } else if (!iterator->second.cacheable) {
+    return;
+  }
+
+  // Whether the start closure reaches a predicate does not depend on the input, so a context with stored results
+  // does not normally get here. Keep the results, but don't use them anymore.
+  iterator->second.cacheable = false;
+  ++_statistics.uncacheableContexts;
+}
+
+FullContextCache::Statistics FullContextCache::getStatistics() const {
+  std::unique_lock<std::mutex> lock(_mutex);
+  return _statistics;
+}
+
+void FullContextCache::clear() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  reset();
+}
+
+void FullContextCache::reset() {
+  _roots.clear();
+  _statistics.predictions = 0;
+  _statistics.uncacheableContexts = 0;
+  _statistics.nodeCount = 0;
+}
@@ -0,0 +1,93 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlr4 {
+namespace atn {
+
+  /// An opt-in cache for the results of full context (LL) predictions, which the DFA cannot hold (see the
+  /// ParserATNSimulator documentation). Decisions which need LL on almost every invocation, e.g. declarations vs.
+  /// expressions in C++, then run the full ATN interpretation only once per outer context and lookahead.
+  ///
+  /// A result is keyed by the decision, the outer context (the invoking states of the rule context stack, as the
+  /// prediction sees them) and the token types which the prediction looked at. Since the prediction stops as soon
+  /// as the lookahead resolves the decision, the lookaheads for one decision and context form a tree and a lookup
+  /// walks the input down that tree until it reaches a result.
+  ///
+  /// Only predictions which did not evaluate a semantic or precedence predicate are stored, because their result
+  /// depends on the parser state. Such a decision/context is remembered as uncacheable. Predictions which end in
+  /// a syntax error are not stored either. Cache hits skip the reportAttemptingFullContext(),
+  /// reportContextSensitivity() and reportAmbiguity() calls (and so the respective error listener calls).
+  ///
+  /// Set it with ParserATNSimulator::setFullContextCache(). It is used in PredictionMode::LL only. A cache must only
+  /// be used with one grammar, but can be shared by any number of parsers (also in different threads) of that
+  /// grammar. When it reaches its size limit, it is cleared and starts over.
+  class ANTLR4CPP_PUBLIC FullContextCache {
+  public:
+    struct Statistics {
+      size_t lookups;
+      size_t hits;
+      size_t predictions; // Stored results.
+      size_t uncacheableContexts; // Decision/context combinations which evaluated predicates.
+      size_t nodeCount; // Lookahead tree nodes, the measure for the size limit.
+      size_t clearCount; // How often the cache was cleared because it was full.
+
+      double hitRate() const;
+    };
+
+    typedef std::vector<size_t> Key;
+
+    /// maxNodes limits the number of lookahead tree nodes (each about 100 bytes).
+    FullContextCache(size_t maxNodes = 100000);
+    FullContextCache(const FullContextCache &other) = delete;
+    ~FullContextCache();
+
+    FullContextCache& operator = (const FullContextCache &other) = delete;
+
+    /// Returns the key for the given decision and the outer context of a prediction.
+    static Key getKey(size_t decision, RuleContext *outerContext);
+
+    /// Returns the cached prediction for the input from startIndex on, or ATN::INVALID_ALT_NUMBER. Moves the input.
+    size_t lookup(const Key &key, TokenStream *input, size_t startIndex);
+
+    /// Stores the prediction for the given lookahead token types (one per prediction step).
+    void add(const Key &key, const std::vector<size_t> &lookahead, size_t prediction);
+
+    /// Marks the decision/context as depending on predicates.
+    void setUncacheable(const Key &key);
+
+    Statistics getStatistics() const;
+    void clear();
+
+  private:
+    struct Node {
+      size_t prediction;
+      std::unordered_map<size_t, std::unique_ptr<Node>> children;
+
+      Node();
+    };
+
+    struct Root {
+      bool cacheable;
+      Node node;
+    };
+
+    struct KeyHasher {
+      size_t operator () (const Key &key) const;
+    };
+
+    const size_t _maxNodes;
+    mutable std::mutex _mutex;
+    std::unordered_map<Key, Root, KeyHasher> _roots;
+    Statistics _statistics;
+
+    void reset();
+  };
+
+} // namespace atn
+} // namespace antlr4
@@ -26,6 +26,12 @@ LexerATNConfig::LexerATNConfig(ATNState *state, int alt, Ref<PredictionContext>
     _passedThroughNonGreedyDecision(false) {
 }
 
+LexerATNConfig::LexerATNConfig(ATNState *state, int alt, Ref<PredictionContext> const& context,
+                               Ref<LexerActionExecutor> const& lexerActionExecutor, bool passedThroughNonGreedyDecision)
+  : ATNConfig(state, alt, context, SemanticContext::NONE), _lexerActionExecutor(lexerActionExecutor),
+    _passedThroughNonGreedyDecision(passedThroughNonGreedyDecision) {
+}
+
 LexerATNConfig::LexerATNConfig(Ref<LexerATNConfig> const& c, ATNState *state)
   : ATNConfig(c, state, c->context, c->semanticContext), _lexerActionExecutor(c->_lexerActionExecutor),
    _passedThroughNonGreedyDecision(checkNonGreedyDecision(c, state)) {
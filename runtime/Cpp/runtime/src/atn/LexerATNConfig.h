@@ -15,10 +15,20 @@ namespace atn {
     LexerATNConfig(ATNState *state, int alt, Ref<PredictionContext> const& context);
     LexerATNConfig(ATNState *state, int alt, Ref<PredictionContext> const& context, Ref<LexerActionExecutor> const& lexerActionExecutor);
 
+    /// Recreates a config with all its fields given, e.g. when loading a DFA snapshot.
+    LexerATNConfig(ATNState *state, int alt, Ref<PredictionContext> const& context, Ref<LexerActionExecutor> const& lexerActionExecutor,
+                   bool passedThroughNonGreedyDecision);
+
     LexerATNConfig(Ref<LexerATNConfig> const& c, ATNState *state);
     LexerATNConfig(Ref<LexerATNConfig> const& c, ATNState *state, Ref<LexerActionExecutor> const& lexerActionExecutor);
     LexerATNConfig(Ref<LexerATNConfig> const& c, ATNState *state, Ref<PredictionContext> const& context);
 
+    template <class... _Types>
+    static Ref<LexerATNConfig> create(_Types&&... _Args)
+      {
+      return antlrcpp::makePooled<LexerATNConfig>(std::forward<_Types>(_Args)...);
+      }
+
     /**
      * Gets the {@link LexerActionExecutor} capable of executing the embedded
      * action(s) for the current configuration.
@@ -15,12 +15,15 @@
 #include "atn/TokensStartState.h"
 #include "misc/Interval.h"
 #include "dfa/DFA.h"
+#include "dfa/LexerDFATable.h"
 #include "Lexer.h"
+#include "ANTLRInputStream.h"
 
 #include "dfa/DFAState.h"
 #include "atn/LexerATNConfig.h"
 #include "atn/LexerActionExecutor.h"
 #include "atn/EmptyPredictionContext.h"
+#include "atn/CompiledATN.h"
 
 #include "atn/LexerATNSimulator.h"
 
@@ -80,6 +83,11 @@ size_t LexerATNSimulator::match(CharStream *input, size_t mode) {
   _startIndex = input->index();
   _prevAccept.reset();
   const dfa::DFA &dfa = _decisionToDFA[mode];
+  dfa.markUsed();
+  const dfa::LexerDFATable *table = dfa.getLexerTable();
+  if (table != nullptr) {
+    return matchTable(input, *table);
+  }
   if (dfa.s0 == nullptr) {
     return matchATN(input);
   } else {
@@ -103,6 +111,121 @@ void LexerATNSimulator::clearDFA() {
   }
 }
 
+bool LexerATNSimulator::buildDFATables(size_t maxStates) {
+  for (ATNState *state : atn.states) {
+    if (state == nullptr) {
+      continue;
+    }
+    for (Transition *transition : state->transitions) {
+      if (transition->getSerializationType() == Transition::PREDICATE) {
+        return false;
+      }
+    }
+  }
+
+  bool result = true;
+  for (size_t mode = 0; mode < atn.modeToStartState.size(); ++mode) {
+    if (_decisionToDFA[mode].getLexerTable() != nullptr) {
+      continue;
+    }
+
+    std::unique_ptr<dfa::LexerDFATable> table = buildDFATable(mode, maxStates);
+    if (table == nullptr) {
+      result = false;
+    } else {
+      _decisionToDFA[mode].setLexerTable(table->minimize());
+    }
+  }
+
+  return result;
+}
+
+std::unique_ptr<dfa::LexerDFATable> LexerATNSimulator::buildDFATable(size_t mode, size_t maxStates) {
+  // The table is built by computing every edge of the mode's DFA (which also completes that). Without
+  // predicates and position dependent actions the simulation doesn't look at the input, so an empty one
+  // stands in for it.
+  ANTLRInputStream noInput;
+  size_t savedMode = _mode;
+  size_t savedStartIndex = _startIndex;
+  auto onExit = finally([this, savedMode, savedStartIndex] {
+    _mode = savedMode;
+    _startIndex = savedStartIndex;
+  });
+  _mode = mode;
+  _startIndex = 0;
+
+  dfa::DFA &dfa = _decisionToDFA[mode];
+  dfa::DFAState *s0 = dfa.s0;
+  if (s0 == nullptr) {
+    s0 = addDFAState(computeStartState(&noInput, atn.modeToStartState[mode]).release());
+    dfa.s0 = s0;
+  }
+
+  // One symbol per column: the ASCII code points, a member of each character class and EOF.
+  size_t columnCount = MAX_DFA_EDGE - MIN_DFA_EDGE + 1 + _compiledATN.getCharClassCount() + 1;
+  auto symbolOf = [this, columnCount](size_t column) -> size_t {
+    if (column <= MAX_DFA_EDGE - MIN_DFA_EDGE) {
+      return MIN_DFA_EDGE + column;
+    }
+    if (column < columnCount - 1) {
+      return _compiledATN.getCharClassMember(column - (MAX_DFA_EDGE - MIN_DFA_EDGE + 1));
+    }
+    return Token::EOF;
+  };
+
+  std::vector<dfa::DFAState *> states = { s0 };
+  std::unordered_map<dfa::DFAState *, uint32_t> stateNumbers = { { s0, 0 } };
+  std::vector<std::vector<dfa::DFAState *>> rows; // The targets per column, null for errors.
+  for (size_t i = 0; i < states.size(); ++i) {
+    dfa::DFAState *s = states[i];
+
+    // Positions of actions are fixed relative to the token start when passing a character after them, which
+    // makes the states depend on the token length.
+    for (auto &config : s->configs->configs) {
+      const Ref<LexerActionExecutor> &executor = std::static_pointer_cast<LexerATNConfig>(config)->getLexerActionExecutor();
+      if (executor != nullptr && !_compiledATN.isRuleStopState(config->state) && executor->fixOffsetBeforeMatch(0) != executor) {
+        return nullptr;
+      }
+    }
+
+    std::vector<dfa::DFAState *> row(columnCount, nullptr);
+    for (size_t column = 0; column < columnCount; ++column) {
+      size_t t = symbolOf(column);
+      dfa::DFAState *target = getExistingTargetState(s, t);
+      if (target == nullptr) {
+        target = computeTargetState(&noInput, s, t);
+      }
+      if (target == ERROR.get()) {
+        continue;
+      }
+
+      if (stateNumbers.insert({ target, static_cast<uint32_t>(states.size()) }).second) {
+        if (states.size() == maxStates) {
+          return nullptr;
+        }
+        states.push_back(target);
+      }
+      row[column] = target;
+    }
+    rows.push_back(std::move(row));
+  }
+
+  /* mem-check: managed by unique_ptr */
+  std::unique_ptr<dfa::LexerDFATable> table(new dfa::LexerDFATable(states.size(), columnCount));
+  for (uint32_t state = 0; state < states.size(); ++state) {
+    for (size_t column = 0; column < columnCount; ++column) {
+      if (rows[state][column] != nullptr) {
+        table->setTarget(state, column, stateNumbers[rows[state][column]]);
+      }
+    }
+    if (states[state]->isAcceptState) {
+      table->setAccept(state, states[state]->prediction, states[state]->lexerActionExecutor);
+    }
+  }
+
+  return table;
+}
+
 size_t LexerATNSimulator::matchATN(CharStream *input) {
   ATNState *startState = atn.modeToStartState[_mode];
 
@@ -180,24 +303,81 @@ size_t LexerATNSimulator::execATN(CharStream *input, dfa::DFAState *ds0) {
   return failOrAccept(input, s->configs.get(), t);
 }
 
+size_t LexerATNSimulator::matchTable(CharStream *input, const dfa::LexerDFATable &table) {
+  // Same as execATN(), with table lookups instead of DFA edges.
+  size_t line = _line;
+  size_t charPositionInLine = _charPositionInLine;
+
+  uint32_t accepted = dfa::LexerDFATable::ERROR_STATE;
+  size_t acceptedIndex = 0;
+  size_t acceptedLine = 0;
+  size_t acceptedCharPos = 0;
+
+  uint32_t s = 0;
+  if (table.isAcceptState(s)) {
+    accepted = s;
+    acceptedIndex = input->index();
+    acceptedLine = _line;
+    acceptedCharPos = _charPositionInLine;
+  }
+
+  size_t t = input->LA(1);
+  while (true) {
+    size_t column = getEdgeIndex(t);
+    uint32_t target = table.getTarget(s, column == INVALID_INDEX ? table.getEofColumn() : column);
+    if (target == dfa::LexerDFATable::ERROR_STATE) {
+      break;
+    }
+
+    if (t != Token::EOF) {
+      consume(input);
+    }
+
+    if (table.isAcceptState(target)) {
+      accepted = target;
+      acceptedIndex = input->index();
+      acceptedLine = _line;
+      acceptedCharPos = _charPositionInLine;
+      if (t == Token::EOF) {
+        break;
+      }
+    }
+
+    t = input->LA(1);
+    s = target;
+  }
+
+  if (accepted != dfa::LexerDFATable::ERROR_STATE) {
+    accept(input, table.getLexerActionExecutor(accepted), _startIndex, acceptedIndex, acceptedLine, acceptedCharPos);
+    return table.getPrediction(accepted);
+  }
+
+  if (t == Token::EOF && input->index() == _startIndex) {
+    return Token::EOF;
+  }
+
+  // Let the DFA simulation fail again, which reports the configurations that didn't match.
+  input->seek(_startIndex);
+  _line = line;
+  _charPositionInLine = charPositionInLine;
+  dfa::DFAState *s0 = _decisionToDFA[_mode].s0;
+  return s0 == nullptr ? matchATN(input) : execATN(input, s0);
+}
+
 dfa::DFAState *LexerATNSimulator::getExistingTargetState(dfa::DFAState *s, size_t t) {
-  if (s->edges.empty()|| /*t < MIN_DFA_EDGE ||*/ t > MAX_DFA_EDGE) { // MIN_DFA_EDGE is 0, hence code gives a warning, if left in.
+  size_t index = getEdgeIndex(t);
+  if (index == INVALID_INDEX) {
     return nullptr;
   }
 
-  _edgeLock.readLock();
-  auto iterator = s->edges.find(t - MIN_DFA_EDGE);
+  dfa::DFAState *target = s->edges.get(index);
 #if DEBUG_ATN == 1
-  if (iterator != s->edges.end()) {
-    std::cout << std::string("reuse state ") << s->stateNumber << std::string(" edge to ") << iterator->second->stateNumber << std::endl;
+  if (target != nullptr) {
+    std::cout << std::string("reuse state ") << s->stateNumber << std::string(" edge to ") << target->stateNumber << std::endl;
   }
 #endif
-  _edgeLock.readUnlock();
-
-  if (iterator == s->edges.end())
-    return nullptr;
 
-  return iterator->second;
+  return target;
 }
 
 dfa::DFAState *LexerATNSimulator::computeTargetState(CharStream *input, dfa::DFAState *s, size_t t) {
@@ -253,18 +433,18 @@ void LexerATNSimulator::getReachableConfigSet(CharStream *input, ATNConfigSet *c
       std::cout << "testing " << getTokenName((int)t) << " at " << c->toString(true) << std::endl;
 #endif
 
-    size_t n = c->state->transitions.size();
-    for (size_t ti = 0; ti < n; ti++) { // for each transition
-      Transition *trans = c->state->transitions[ti];
-      ATNState *target = getReachableTarget(trans, (int)t);
-      if (target != nullptr) {
+    const CompiledATN::State &state = _compiledATN.getState(c->state->stateNumber);
+    const CompiledATN::CompiledTransition *end = _compiledATN.transitionsEnd(state);
+    for (auto trans = _compiledATN.transitionsBegin(state); trans != end; ++trans) { // for each transition
+      if (CompiledATN::matches(*trans, t, Lexer::MIN_CHAR_VALUE, Lexer::MAX_CHAR_VALUE)) {
+        ATNState *target = trans->target;
         Ref<LexerActionExecutor> lexerActionExecutor = std::static_pointer_cast<LexerATNConfig>(c)->getLexerActionExecutor();
         if (lexerActionExecutor != nullptr) {
           lexerActionExecutor = lexerActionExecutor->fixOffsetBeforeMatch((int)input->index() - (int)_startIndex);
         }
 
         bool treatEofAsEpsilon = t == Token::EOF;
-        Ref<LexerATNConfig> config = std::make_shared<LexerATNConfig>(std::static_pointer_cast<LexerATNConfig>(c),
+        Ref<LexerATNConfig> config = LexerATNConfig::create(std::static_pointer_cast<LexerATNConfig>(c),
           target, lexerActionExecutor);
 
         if (closure(input, config, reach, currentAltReachedAcceptState, true, treatEofAsEpsilon)) {
@@ -308,7 +488,7 @@ std::unique_ptr<ATNConfigSet> LexerATNSimulator::computeStartState(CharStream *i
   std::unique_ptr<ATNConfigSet> configs(new OrderedATNConfigSet());
   for (size_t i = 0; i < p->transitions.size(); i++) {
     ATNState *target = p->transitions[i]->target;
-    Ref<LexerATNConfig> c = std::make_shared<LexerATNConfig>(target, (int)(i + 1), initialContext);
+    Ref<LexerATNConfig> c = LexerATNConfig::create(target, (int)(i + 1), initialContext);
     closure(input, c, configs.get(), false, false, false);
   }
 
@@ -321,7 +501,8 @@ bool LexerATNSimulator::closure(CharStream *input, const Ref<LexerATNConfig> &co
     std::cout << "closure(" << config->toString(true) << ")" << std::endl;
 #endif
 
-  if (is<RuleStopState *>(config->state)) {
+  const CompiledATN::State &state = _compiledATN.getState(config->state->stateNumber);
+  if (state.type == ATNState::RULE_STOP) {
 #if DEBUG_ATN == 1
       if (_recog != nullptr) {
         std::cout << "closure at " << _recog->getRuleNames()[config->state->ruleIndex] << " rule stop " << config << std::endl;
@@ -335,7 +516,7 @@ bool LexerATNSimulator::closure(CharStream *input, const Ref<LexerATNConfig> &co
         configs->add(config);
         return true;
       } else {
-        configs->add(std::make_shared<LexerATNConfig>(config, config->state, PredictionContext::EMPTY));
+        configs->add(LexerATNConfig::create(config, config->state, PredictionContext::EMPTY));
         currentAltReachedAcceptState = true;
       }
     }
@@ -345,7 +526,7 @@ bool LexerATNSimulator::closure(CharStream *input, const Ref<LexerATNConfig> &co
         if (config->context->getReturnState(i) != PredictionContext::EMPTY_RETURN_STATE) {
           std::weak_ptr<PredictionContext> newContext = config->context->getParent(i); // "pop" return state
           ATNState *returnState = atn.states[config->context->getReturnState(i)];
-          Ref<LexerATNConfig> c = std::make_shared<LexerATNConfig>(config, returnState, newContext.lock());
+          Ref<LexerATNConfig> c = LexerATNConfig::create(config, returnState, newContext.lock());
           currentAltReachedAcceptState = closure(input, c, configs, currentAltReachedAcceptState, speculative, treatEofAsEpsilon);
         }
       }
@@ -355,16 +536,18 @@ bool LexerATNSimulator::closure(CharStream *input, const Ref<LexerATNConfig> &co
   }
 
   // optimization
-  if (!config->state->epsilonOnlyTransitions) {
+  if (!state.epsilonOnlyTransitions) {
     if (!currentAltReachedAcceptState || !config->hasPassedThroughNonGreedyDecision()) {
       configs->add(config);
     }
   }
 
-  ATNState *p = config->state;
-  for (size_t i = 0; i < p->transitions.size(); i++) {
-    Transition *t = p->transitions[i];
-    Ref<LexerATNConfig> c = getEpsilonTarget(input, config, t, configs, speculative, treatEofAsEpsilon);
+  const CompiledATN::CompiledTransition *end = _compiledATN.transitionsEnd(state);
+  for (auto t = _compiledATN.transitionsBegin(state); t != end; ++t) {
+    if (!t->isEpsilon && !treatEofAsEpsilon) {
+      continue; // Only epsilon transitions (and EOF, if treated like one) lead anywhere without input.
+    }
+    Ref<LexerATNConfig> c = getEpsilonTarget(input, config, t->transition, configs, speculative, treatEofAsEpsilon);
     if (c != nullptr) {
       currentAltReachedAcceptState = closure(input, c, configs, currentAltReachedAcceptState, speculative, treatEofAsEpsilon);
     }
@@ -381,7 +564,7 @@ Ref<LexerATNConfig> LexerATNSimulator::getEpsilonTarget(CharStream *input, const
     case Transition::RULE: {
       RuleTransition *ruleTransition = static_cast<RuleTransition*>(t);
       Ref<PredictionContext> newContext = SingletonPredictionContext::create(config->context, ruleTransition->followState->stateNumber);
-      c = std::make_shared<LexerATNConfig>(config, t->target, newContext);
+      c = LexerATNConfig::create(config, t->target, newContext);
       break;
     }
 
@@ -415,7 +598,7 @@ Ref<LexerATNConfig> LexerATNSimulator::getEpsilonTarget(CharStream *input, const
 
       configs->hasSemanticContext = true;
       if (evaluatePredicate(input, pt->ruleIndex, pt->predIndex, speculative)) {
-        c = std::make_shared<LexerATNConfig>(config, t->target);
+        c = LexerATNConfig::create(config, t->target);
       }
       break;
     }
@@ -436,17 +619,17 @@ Ref<LexerATNConfig> LexerATNSimulator::getEpsilonTarget(CharStream *input, const
         // the split operation.
         Ref<LexerActionExecutor> lexerActionExecutor = LexerActionExecutor::append(config->getLexerActionExecutor(),
           atn.lexerActions[static_cast<ActionTransition *>(t)->actionIndex]);
-        c = std::make_shared<LexerATNConfig>(config, t->target, lexerActionExecutor);
+        c = LexerATNConfig::create(config, t->target, lexerActionExecutor);
         break;
       }
       else {
         // ignore actions in referenced rules
-        c = std::make_shared<LexerATNConfig>(config, t->target);
+        c = LexerATNConfig::create(config, t->target);
         break;
       }
 
     case Transition::EPSILON:
-      c = std::make_shared<LexerATNConfig>(config, t->target);
+      c = LexerATNConfig::create(config, t->target);
       break;
 
     case Transition::ATOM:
@@ -454,7 +637,7 @@ Ref<LexerATNConfig> LexerATNSimulator::getEpsilonTarget(CharStream *input, const
     case Transition::SET:
       if (treatEofAsEpsilon) {
         if (t->matches(Token::EOF, Lexer::MIN_CHAR_VALUE, Lexer::MAX_CHAR_VALUE)) {
-          c = std::make_shared<LexerATNConfig>(config, t->target);
+          c = LexerATNConfig::create(config, t->target);
           break;
         }
       }
@@ -527,14 +710,27 @@ dfa::DFAState *LexerATNSimulator::addDFAEdge(dfa::DFAState *from, size_t t, ATNC
 }
 
 void LexerATNSimulator::addDFAEdge(dfa::DFAState *p, size_t t, dfa::DFAState *q) {
-  if (/*t < MIN_DFA_EDGE ||*/ t > MAX_DFA_EDGE) { // MIN_DFA_EDGE is 0
-    // Only track edges within the DFA bounds
+  size_t index = getEdgeIndex(t);
+  if (index == INVALID_INDEX) {
     return;
   }
 
-  _edgeLock.writeLock();
-  p->edges[t - MIN_DFA_EDGE] = q; // connect
-  _edgeLock.writeUnlock();
+  // The table starts with room for the ASCII edges only, the class edges are added when first needed.
+  size_t capacity = MAX_DFA_EDGE - MIN_DFA_EDGE + 1;
+  if (index >= capacity) {
+    capacity += _compiledATN.getCharClassCount();
+  }
+  p->edges.set(index, q, capacity); // connect, visible to readers without a lock
+}
+
+size_t LexerATNSimulator::getEdgeIndex(size_t t) const {
+  if (t <= MAX_DFA_EDGE) { // MIN_DFA_EDGE is 0
+    return t - MIN_DFA_EDGE;
+  }
+  if (t <= Lexer::MAX_CHAR_VALUE) {
+    return MAX_DFA_EDGE - MIN_DFA_EDGE + 1 + _compiledATN.getCharClass(t);
+  }
+  return INVALID_INDEX;
 }
 
 dfa::DFAState *LexerATNSimulator::addDFAState(ATNConfigSet *configs) {
@@ -546,7 +742,7 @@ dfa::DFAState *LexerATNSimulator::addDFAState(ATNConfigSet *configs) {
   dfa::DFAState *proposed = new dfa::DFAState(std::unique_ptr<ATNConfigSet>(configs)); /* mem-check: managed by the DFA or deleted below */
   Ref<ATNConfig> firstConfigWithRuleStopState = nullptr;
   for (const auto &c : configs->configs) {
-    if (is<RuleStopState *>(c->state)) {
+    if (_compiledATN.isRuleStopState(c->state)) {
       firstConfigWithRuleStopState = c;
       break;
     }
@@ -560,12 +756,11 @@ dfa::DFAState *LexerATNSimulator::addDFAState(ATNConfigSet *configs) {
 
   dfa::DFA &dfa = _decisionToDFA[_mode];
 
-  _stateLock.writeLock();
+  std::lock_guard<std::mutex> lck(dfa.stateLock);
   if (!dfa.states.empty()) {
     auto iterator = dfa.states.find(proposed);
     if (iterator != dfa.states.end()) {
       delete proposed;
-      _stateLock.writeUnlock();
       return *iterator;
     }
   }
@@ -574,7 +769,6 @@ dfa::DFAState *LexerATNSimulator::addDFAState(ATNConfigSet *configs) {
   proposed->configs->setReadonly(true);
 
   dfa.states.insert(proposed);
-  _stateLock.writeUnlock();
 
   return proposed;
 }
@@ -583,6 +777,10 @@ dfa::DFA& LexerATNSimulator::getDFA(size_t mode) {
   return _decisionToDFA[mode];
 }
 
+std::vector<dfa::DFA>& LexerATNSimulator::getDecisionToDFA() {
+  return _decisionToDFA;
+}
+
 std::string LexerATNSimulator::getText(CharStream *input) {
   // index is first lookahead char, don't include.
   return input->getText(misc::Interval(_startIndex, input->index() - 1));
@@ -38,8 +38,11 @@ namespace atn {
 
 
   public:
+    /// DFA edges for the code points MIN_DFA_EDGE..MAX_DFA_EDGE are indexed by the code point. Edges for code
+    /// points above are indexed by their character class (see CompiledATN::getCharClass()), starting at
+    /// MAX_DFA_EDGE + 1.
     static const size_t MIN_DFA_EDGE = 0;
-    static const size_t MAX_DFA_EDGE = 127; // forces unicode to stay in ATN
+    static const size_t MAX_DFA_EDGE = 127;
 
   protected:
     /// <summary>
@@ -93,8 +96,19 @@ namespace atn {
 
     virtual void clearDFA() override;
 
+    /// Builds the complete DFA of every mode up front and stores it as a minimized transition table in the DFA
+    /// of the mode, so that all lexers sharing the DFAs scan with a plain table lookup per character. This is
+    /// opt-in: the tables can be much larger than the part of the DFA an input actually needs, and building
+    /// them takes a while for big grammars.
+    ///
+    /// Returns false (and builds nothing) if the grammar has predicates, since those are evaluated while
+    /// lexing. Modes whose DFA has more than maxStates states, which happens with actions that depend on their
+    /// position in a token, are left to the usual simulation; the return value is false then as well.
+    virtual bool buildDFATables(size_t maxStates = 10000);
+
   protected:
     virtual size_t matchATN(CharStream *input);
+    virtual size_t matchTable(CharStream *input, const dfa::LexerDFATable &table);
     virtual size_t execATN(CharStream *input, dfa::DFAState *ds0);
 
     /// <summary>
@@ -135,6 +149,7 @@ namespace atn {
     virtual void accept(CharStream *input, const Ref<LexerActionExecutor> &lexerActionExecutor, size_t startIndex, size_t index,
                         size_t line, size_t charPos);
 
+    /// Not called by getReachableConfigSet() anymore, which matches the transitions of the compiled ATN directly.
     virtual ATNState *getReachableTarget(Transition *trans, size_t t);
 
     virtual std::unique_ptr<ATNConfigSet> computeStartState(CharStream *input, ATNState *p);
@@ -192,6 +207,9 @@ namespace atn {
   public:
     dfa::DFA& getDFA(size_t mode);
 
+    /// The DFAs of all modes (e.g. for {@link dfa::DFASnapshot}).
+    virtual std::vector<dfa::DFA>& getDecisionToDFA() override;
+
     /// Get the text matched so far for the current token.
     virtual std::string getText(CharStream *input);
     virtual size_t getLine() const;
@@ -202,6 +220,11 @@ namespace atn {
     virtual std::string getTokenName(size_t t);
 
   private:
+    /// The index of the DFA edge for the given input symbol or INVALID_INDEX if there is none (EOF).
+    size_t getEdgeIndex(size_t t) const;
+
+    std::unique_ptr<dfa::LexerDFATable> buildDFATable(size_t mode, size_t maxStates);
+
     void InitializeInstanceFields();
   };
 
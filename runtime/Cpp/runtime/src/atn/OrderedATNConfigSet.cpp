@@ -3,6 +3,8 @@
  * can be found in the LICENSE.txt file in the project root.
  */
 
+#include "atn/LexerATNConfig.h"
+
 #include "atn/OrderedATNConfigSet.h"
 
 using namespace antlr4::atn;
@@ -10,3 +12,13 @@ using namespace antlr4::atn;
 size_t OrderedATNConfigSet::getHash(ATNConfig *c) {
   return c->hashCode();
 }
+
+bool OrderedATNConfigSet::isSameConfig(ATNConfig *lhs, ATNConfig *rhs) {
+  // The lexer only adds LexerATNConfigs, whose identity includes the action executor and non-greedy flag.
+  LexerATNConfig *lexerLhs = dynamic_cast<LexerATNConfig *>(lhs);
+  LexerATNConfig *lexerRhs = dynamic_cast<LexerATNConfig *>(rhs);
+  if (lexerLhs != nullptr && lexerRhs != nullptr) {
+    return *lexerLhs == *lexerRhs;
+  }
+  return *lhs == *rhs;
+}
@@ -25,6 +25,7 @@
 #include "atn/StarLoopEntryState.h"
 #include "atn/BlockStartState.h"
 #include "atn/BlockEndState.h"
+#include "atn/CompiledATN.h"
 
 #include "misc/Interval.h"
 #include "ANTLRErrorListener.h"
@@ -68,6 +69,10 @@ void ParserATNSimulator::clearDFA() {
   }
 }
 
+std::vector<dfa::DFA>& ParserATNSimulator::getDecisionToDFA() {
+  return decisionToDFA;
+}
+
 size_t ParserATNSimulator::adaptivePredict(TokenStream *input, size_t decision, ParserRuleContext *outerContext) {
 
 #if DEBUG_ATN == 1 || DEBUG_LIST_ATN_DECISIONS == 1
@@ -79,6 +84,7 @@ size_t ParserATNSimulator::adaptivePredict(TokenStream *input, size_t decision,
   _startIndex = input->index();
   _outerContext = outerContext;
   dfa::DFA &dfa = decisionToDFA[decision];
+  dfa.markUsed();
   _dfa = &dfa;
 
   ssize_t m = input->mark();
@@ -108,7 +114,7 @@ size_t ParserATNSimulator::adaptivePredict(TokenStream *input, size_t decision,
     std::unique_ptr<ATNConfigSet> s0_closure = computeStartState(dynamic_cast<ATNState *>(dfa.atnStartState),
                                                                  &ParserRuleContext::EMPTY, fullCtx);
 
-    _stateLock.writeLock();
+    std::lock_guard<std::mutex> lck(dfa.stateLock);
     if (dfa.isPrecedenceDfa()) {
       /* If this is a precedence DFA, we use applyPrecedenceFilter
        * to convert the computed start state to a precedence start
@@ -119,7 +125,7 @@ size_t ParserATNSimulator::adaptivePredict(TokenStream *input, size_t decision,
       dfa.s0->configs = std::move(s0_closure); // not used for prediction but useful to know start configs anyway
       dfa::DFAState *newState = new dfa::DFAState(applyPrecedenceFilter(dfa.s0->configs.get())); /* mem-check: managed by the DFA or deleted below */
       s0 = addDFAState(dfa, newState);
-      dfa.setPrecedenceStartState(parser->getPrecedence(), s0, _edgeLock);
+      dfa.setPrecedenceStartState(parser->getPrecedence(), s0);
       if (s0 != newState) {
         delete newState; // If there was already a state with this config set we don't need the new one.
       }
@@ -127,13 +133,12 @@ size_t ParserATNSimulator::adaptivePredict(TokenStream *input, size_t decision,
       dfa::DFAState *newState = new dfa::DFAState(std::move(s0_closure)); /* mem-check: managed by the DFA or deleted below */
       s0 = addDFAState(dfa, newState);
 
-      delete dfa.s0; // Delete existing s0 DFA state, if there's any. 
+      // An existing s0 is owned by dfa.states (another thread may have been faster), so we must not delete it.
       dfa.s0 = s0;
       if (s0 != newState) {
         delete newState; // If there was already a state with this config set we don't need the new one.
       }
     }
-    _stateLock.writeUnlock();
   }
 
   // We can start with an existing DFA.
@@ -217,7 +222,18 @@ size_t ParserATNSimulator::execATN(dfa::DFA &dfa, dfa::DFAState *s0, TokenStream
         std::cout << "ctx sensitive state " << outerContext << " in " << D << std::endl;
 #endif
 
+      _cacheFullContextPrediction = _fullContextCache != nullptr && _mode == PredictionMode::LL;
+      if (_cacheFullContextPrediction) {
+        _fullContextCacheKey = FullContextCache::getKey(dfa.decision, outerContext);
+        size_t alt = _fullContextCache->lookup(_fullContextCacheKey, input, startIndex);
+        if (alt != ATN::INVALID_ALT_NUMBER) {
+          _cacheFullContextPrediction = false;
+          return alt;
+        }
+      }
+
       bool fullCtx = true;
+      _fullContextPredicateEvaluated = false;
       Ref<ATNConfigSet> s0_closure = computeStartState(dfa.atnStartState, outerContext, fullCtx);
       reportAttemptingFullContext(dfa, conflictingAlts, D->configs.get(), startIndex, input->index());
       size_t alt = execATNWithFullContext(dfa, D, s0_closure.get(), input, startIndex, outerContext);
@@ -257,14 +273,8 @@ size_t ParserATNSimulator::execATN(dfa::DFA &dfa, dfa::DFAState *s0, TokenStream
 }
 
 dfa::DFAState *ParserATNSimulator::getExistingTargetState(dfa::DFAState *previousD, size_t t) {
-  _edgeLock.readLock();
-  auto iterator = previousD->edges.find(t);
-  _edgeLock.readUnlock();
-  if (iterator == previousD->edges.end()) {
-    return nullptr;
-  }
-
-  return iterator->second;
+  // Edges are shifted up by one so that EOF (-1) maps to index 0.
+  return previousD->edges.get(t + 1);
 }
 
 dfa::DFAState *ParserATNSimulator::computeTargetState(dfa::DFA &dfa, dfa::DFAState *previousD, size_t t) {
@@ -339,7 +349,16 @@ size_t ParserATNSimulator::execATNWithFullContext(dfa::DFA &dfa, dfa::DFAState *
   size_t t = input->LA(1);
   size_t predictedAlt;
 
+  // The prediction is only cached if it doesn't end with an error, so take over the flag.
+  bool cachePrediction = _cacheFullContextPrediction;
+  _cacheFullContextPrediction = false;
+  std::vector<size_t> lookahead;
+
   while (true) {
+    if (cachePrediction) {
+      lookahead.push_back(t);
+    }
+
     reach = computeReachSet(previous, t, fullCtx);
     if (reach == nullptr) {
       // if any configs in previous dipped into outer context, that
@@ -395,6 +414,14 @@ size_t ParserATNSimulator::execATNWithFullContext(dfa::DFA &dfa, dfa::DFAState *
     }
   }
 
+  if (cachePrediction) {
+    if (_fullContextPredicateEvaluated) {
+      _fullContextCache->setUncacheable(_fullContextCacheKey);
+    } else {
+      _fullContextCache->add(_fullContextCacheKey, lookahead, predictedAlt);
+    }
+  }
+
   // If the configuration set uniquely predicts an alternative,
   // without conflict, then we know that it's a full LL decision
   // not SLL.
@@ -453,7 +480,8 @@ std::unique_ptr<ATNConfigSet> ParserATNSimulator::computeReachSet(ATNConfigSet *
 
   // First figure out where we can reach on input t
   for (const auto &c : closure_->configs) {
-    if (is<RuleStopState *>(c->state)) {
+    const CompiledATN::State &state = _compiledATN.getState(c->state->stateNumber);
+    if (state.type == ATNState::RULE_STOP) {
       assert(c->context->isEmpty());
 
       if (fullCtx || t == Token::EOF) {
@@ -463,12 +491,10 @@ std::unique_ptr<ATNConfigSet> ParserATNSimulator::computeReachSet(ATNConfigSet *
       continue;
     }
 
-    size_t n = c->state->transitions.size();
-    for (size_t ti = 0; ti < n; ti++) { // for each transition
-      Transition *trans = c->state->transitions[ti];
-      ATNState *target = getReachableTarget(trans, (int)t);
-      if (target != nullptr) {
-        intermediate->add(ATNConfig::create(c, target), &mergeCache);
+    const CompiledATN::CompiledTransition *end = _compiledATN.transitionsEnd(state);
+    for (auto trans = _compiledATN.transitionsBegin(state); trans != end; ++trans) { // for each transition
+      if (CompiledATN::matches(*trans, t, 0, atn.maxTokenType)) {
+        intermediate->add(ATNConfig::create(c, trans->target), &mergeCache);
       }
     }
   }
@@ -566,13 +592,13 @@ ATNConfigSet* ParserATNSimulator::removeAllConfigsNotInRuleStopState(ATNConfigSe
   ATNConfigSet *result = new ATNConfigSet(configs->fullCtx); /* mem-check: released by caller */
 
   for (const auto &config : configs->configs) {
-    if (is<RuleStopState*>(config->state)) {
+    if (_compiledATN.isRuleStopState(config->state)) {
       result->add(config, &mergeCache);
       continue;
     }
 
     if (lookToEndOfRule && config->state->epsilonOnlyTransitions) {
-      misc::IntervalSet nextTokens = atn.nextTokens(config->state);
+      const misc::IntervalSet &nextTokens = atn.nextTokens(config->state);
       if (nextTokens.contains(Token::EPSILON)) {
         ATNState *endOfRuleState = atn.ruleToStopState[config->state->ruleIndex];
         result->add(ATNConfig::create(config, endOfRuleState), &mergeCache);
@@ -745,7 +771,7 @@ size_t ParserATNSimulator::getSynValidOrSemInvalidAltThatFinishedDecisionEntryRu
 size_t ParserATNSimulator::getAltThatFinishedDecisionEntryRule(ATNConfigSet *configs) {
   misc::IntervalSet alts;
   for (auto &c : configs->configs) {
-    if (c->getOuterContextDepth() > 0 || (is<RuleStopState *>(c->state) && c->context->hasEmptyPath())) {
+    if (c->getOuterContextDepth() > 0 || (_compiledATN.isRuleStopState(c->state) && c->context->hasEmptyPath())) {
       alts.add(c->alt);
     }
   }
@@ -829,7 +855,7 @@ void ParserATNSimulator::closureCheckingStopState(Ref<ATNConfig> const& config,
     std::cout << "closure(" << config->toString(true) << ")" << std::endl;
 #endif
 
-  if (is<RuleStopState *>(config->state)) {
+  if (_compiledATN.isRuleStopState(config->state)) {
     // We hit rule end. If we have context info, use it
     // run thru all possible stack tops in ctx
     if (!config->context->isEmpty()) {
@@ -877,23 +903,26 @@ void ParserATNSimulator::closureCheckingStopState(Ref<ATNConfig> const& config,
 
 void ParserATNSimulator::closure_(Ref<ATNConfig> const& config, ATNConfigSet *configs, ATNConfig::Set &closureBusy,
                                   bool collectPredicates, bool fullCtx, int depth, bool treatEofAsEpsilon) {
-  ATNState *p = config->state;
+  const CompiledATN::State &p = _compiledATN.getState(config->state->stateNumber);
   // optimization
-  if (!p->epsilonOnlyTransitions) {
+  if (!p.epsilonOnlyTransitions) {
     // make sure to not return here, because EOF transitions can act as
     // both epsilon transitions and non-epsilon transitions.
     configs->add(config, &mergeCache);
   }
 
-  for (size_t i = 0; i < p->transitions.size(); i++) {
-    if (i == 0 && canDropLoopEntryEdgeInLeftRecursiveRule(config.get()))
+  const CompiledATN::CompiledTransition *begin = _compiledATN.transitionsBegin(p);
+  const CompiledATN::CompiledTransition *end = _compiledATN.transitionsEnd(p);
+  for (auto t = begin; t != end; ++t) {
+    if (t == begin && canDropLoopEntryEdgeInLeftRecursiveRule(config.get()))
       continue;
+    if (!t->isEpsilon && !treatEofAsEpsilon)
+      continue; // getEpsilonTarget() would return null.
 
-    Transition *t = p->transitions[i];
-    bool continueCollecting = !is<ActionTransition*>(t) && collectPredicates;
-    Ref<ATNConfig> c = getEpsilonTarget(config, t, continueCollecting, depth == 0, fullCtx, treatEofAsEpsilon);
+    bool continueCollecting = t->type != Transition::ACTION && collectPredicates;
+    Ref<ATNConfig> c = getEpsilonTarget(config, t->transition, continueCollecting, depth == 0, fullCtx, treatEofAsEpsilon);
     if (c != nullptr) {
-      if (!t->isEpsilon()) {
+      if (!t->isEpsilon) {
         // avoid infinite recursion for EOF* and EOF+
         if (closureBusy.count(c) == 0) {
           closureBusy.insert(c);
@@ -903,7 +932,7 @@ void ParserATNSimulator::closure_(Ref<ATNConfig> const& config, ATNConfigSet *co
       }
 
       int newDepth = depth;
-      if (is<RuleStopState*>(config->state)) {
+      if (p.type == ATNState::RULE_STOP) {
         assert(!fullCtx);
 
         // target fell off end of rule; mark resulting c as having dipped into outer context
@@ -919,7 +948,7 @@ void ParserATNSimulator::closure_(Ref<ATNConfig> const& config, ATNConfigSet *co
         closureBusy.insert(c);
 
         if (_dfa != nullptr && _dfa->isPrecedenceDfa()) {
-          size_t outermostPrecedenceReturn = dynamic_cast<EpsilonTransition *>(t)->outermostPrecedenceReturn();
+          size_t outermostPrecedenceReturn = t->from; // Only epsilon transitions leave a rule stop state.
           if (outermostPrecedenceReturn == _dfa->atnStartState->ruleIndex) {
             c->setPrecedenceFilterSuppressed(true);
           }
@@ -934,7 +963,7 @@ void ParserATNSimulator::closure_(Ref<ATNConfig> const& config, ATNConfigSet *co
           std::cout << "dips into outer ctx: " << c << std::endl;
 #endif
 
-      } else if (is<RuleTransition*>(t)) {
+      } else if (t->type == Transition::RULE) {
         // latch when newDepth goes negative - once we step out of the entry context we can't return
         if (newDepth >= 0) {
           newDepth++;
@@ -1095,6 +1124,7 @@ Ref<ATNConfig> ParserATNSimulator::precedenceTransition(Ref<ATNConfig> const& co
       // later during conflict resolution.
       size_t currentPosition = _input->index();
       _input->seek(_startIndex);
+      _fullContextPredicateEvaluated = true;
       bool predSucceeds = evalSemanticContext(pt->getPredicate(), _outerContext, config->alt, fullCtx);
       _input->seek(currentPosition);
       if (predSucceeds) {
@@ -1134,6 +1164,7 @@ Ref<ATNConfig> ParserATNSimulator::predTransition(Ref<ATNConfig> const& config,
       // later during conflict resolution.
       size_t currentPosition = _input->index();
       _input->seek(_startIndex);
+      _fullContextPredicateEvaluated = true;
       bool predSucceeds = evalSemanticContext(pt->getPredicate(), _outerContext, config->alt, fullCtx);
       _input->seek(currentPosition);
       if (predSucceeds) {
@@ -1244,18 +1275,15 @@ dfa::DFAState *ParserATNSimulator::addDFAEdge(dfa::DFA &dfa, dfa::DFAState *from
     return nullptr;
   }
 
-  _stateLock.writeLock();
-  to = addDFAState(dfa, to); // used existing if possible not incoming
-  _stateLock.writeUnlock();
+  {
+    std::lock_guard<std::mutex> lck(dfa.stateLock);
+    to = addDFAState(dfa, to); // used existing if possible not incoming
+  }
   if (from == nullptr || t > (int)atn.maxTokenType) {
     return to;
   }
 
-  {
-    _edgeLock.writeLock();
-    from->edges[t] = to; // connect
-    _edgeLock.writeUnlock();
-  }
+  from->edges.set((size_t)(t + 1), to, atn.maxTokenType + 2); // connect, visible to readers without a lock
 
 #if DEBUG_DFA == 1
     std::string dfaText;
@@ -1384,6 +1412,14 @@ atn::PredictionMode ParserATNSimulator::getPredictionMode() {
   return _mode;
 }
 
+void ParserATNSimulator::setFullContextCache(Ref<FullContextCache> const& cache) {
+  _fullContextCache = cache;
+}
+
+Ref<FullContextCache> ParserATNSimulator::getFullContextCache() const {
+  return _fullContextCache;
+}
+
 Parser* ParserATNSimulator::getParser() {
   return parser;
 }
@@ -1399,4 +1435,6 @@ bool ParserATNSimulator::getLrLoopSetting() {
 void ParserATNSimulator::InitializeInstanceFields() {
   _mode = PredictionMode::LL;
   _startIndex = 0;
+  _cacheFullContextPrediction = false;
+  _fullContextPredicateEvaluated = false;
 }
@@ -11,6 +11,7 @@
 #include "atn/PredictionContext.h"
 #include "SemanticContext.h"
 #include "atn/ATNConfig.h"
+#include "atn/FullContextCache.h"
 
 namespace antlr4 {
 namespace atn {
@@ -171,9 +172,9 @@ namespace atn {
    * <p>
    * The {@link ParserATNSimulator} locks on the {@link #decisionToDFA} field when
    * it adds a new DFA object to that array. {@link #addDFAEdge}
-   * locks on the DFA for the current decision when setting the
-   * {@link DFAState#edges} field. {@link #addDFAState} locks on
-   * the DFA for the current decision when looking up a DFA state to see if it
+   * publishes new {@link DFAState#edges} entries with an atomic store, without
+   * any lock. {@link #addDFAState} locks on
+   * the DFA for the current decision ({@link DFA#stateLock}) when looking up a DFA state to see if it
    * already exists. We must make sure that all requests to add DFA states that
    * are equivalent result in the same shared DFA object. This is because lots of
    * threads will be trying to update the DFA at once. The
@@ -253,6 +254,7 @@ namespace atn {
 
     virtual void reset() override;
     virtual void clearDFA() override;
+    virtual std::vector<dfa::DFA>& getDecisionToDFA() override;
     virtual size_t adaptivePredict(TokenStream *input, size_t decision, ParserRuleContext *outerContext);
     
     static const bool TURN_OFF_LR_LOOP_ENTRY_BRANCH_OPT;
@@ -354,6 +356,11 @@ namespace atn {
     void setPredictionMode(PredictionMode newMode);
     PredictionMode getPredictionMode();
 
+    /// Sets a cache for full context predictions (nullptr to stop caching). See FullContextCache for when it helps
+    /// and what it changes. The cache can be shared with the simulators of other parsers for the same grammar.
+    void setFullContextCache(Ref<FullContextCache> const& cache);
+    Ref<FullContextCache> getFullContextCache() const;
+
     Parser* getParser();
     
     virtual std::string getTokenName(size_t t);
@@ -646,6 +653,7 @@ namespace atn {
      */
     std::unique_ptr<ATNConfigSet> applyPrecedenceFilter(ATNConfigSet *configs);
 
+    /// Not called by computeReachSet() anymore, which matches the transitions of the compiled ATN directly.
     virtual ATNState *getReachableTarget(Transition *trans, size_t ttype);
 
     virtual std::vector<Ref<SemanticContext>> getPredsForAmbigAlts(const antlrcpp::BitSet &ambigAlts,
@@ -895,6 +903,13 @@ namespace atn {
     // SLL, LL, or LL + exact ambig detection?
     PredictionMode _mode;
 
+    Ref<FullContextCache> _fullContextCache;
+
+    // Passed from execATN() to execATNWithFullContext(), like the globals above.
+    bool _cacheFullContextPrediction;
+    FullContextCache::Key _fullContextCacheKey;
+    bool _fullContextPredicateEvaluated; // Set when the full context closure evaluates a predicate.
+
     static bool getLrLoopSetting();
     void InitializeInstanceFields();
   };
@@ -374,7 +374,7 @@ Ref<PredictionContext> PredictionContext::mergeArrays(const Ref<ArrayPredictionC
 bool PredictionContext::combineCommonParents(std::vector<Ref<PredictionContext>> &parents) {
   return true;
 
-  PredictionContextCache uniqueParents;
+  std::unordered_set<Ref<PredictionContext>, PredictionContextHasher, PredictionContextComparer> uniqueParents;
 
   uniqueParents.insert(parents.cbegin(), parents.cend());
 
@@ -471,11 +471,11 @@ Ref<PredictionContext> PredictionContext::getCachedContext(const Ref<PredictionC
       return iterator->second; // Not necessarly the same as context.
   }
 
-  auto iterator = contextCache.find(context);
-  if (iterator != contextCache.end()) {
-    visited[context] = *iterator;
+  Ref<PredictionContext> cached = contextCache.find(context);
+  if (cached != nullptr) {
+    visited[context] = cached;
 
-    return *iterator;
+    return cached;
   }
 
   bool changed = false;
@@ -497,25 +497,25 @@ Ref<PredictionContext> PredictionContext::getCachedContext(const Ref<PredictionC
     }
   }
 
+  // Another thread may have added an equal context meanwhile, so always use what the cache returns.
   if (!changed) {
-    contextCache.insert(context);
-    visited[context] = context;
+    cached = contextCache.getOrAdd(context);
+    visited[context] = cached;
 
-    return context;
+    return cached;
   }
 
   Ref<PredictionContext> updated;
   if (parents.empty()) {
     updated = EMPTY;
   } else if (parents.size() == 1) {
-    updated = SingletonPredictionContext::create(parents[0], context->getReturnState(0));
-    contextCache.insert(updated);
+    updated = contextCache.getOrAdd(SingletonPredictionContext::create(parents[0], context->getReturnState(0)));
   } else {
     ArrayPredictionContext::TReturnStateStorageRange returnStatesRange;
     auto arrayCtx = std::dynamic_pointer_cast<ArrayPredictionContext>(context);
     arrayCtx->getStorageRanges(&returnStatesRange);
-    updated = ArrayPredictionContext::makePredictionContext(std::move(parents), returnStatesRange);
-    contextCache.insert(updated);
+    updated = contextCache.getOrAdd(ArrayPredictionContext::makePredictionContext(std::move(parents),
+      returnStatesRange));
   }
 
   visited[updated] = updated;
@@ -629,6 +629,106 @@ std::vector<std::string> PredictionContext::toStrings(Recognizer *recognizer, co
   return result;
 }
 
+//----------------- PredictionContextCache -----------------------------------------------------------------------------
+
+PredictionContextCache::PredictionContextCache() : _bytes(0), _capacity(0) {
+}
+
+Ref<PredictionContext> PredictionContextCache::find(const Ref<PredictionContext> &context) {
+  Shard &shard = shardFor(*context);
+  std::lock_guard<std::mutex> lock(shard.lock);
+
+  ++shard.lookups;
+  auto iterator = shard.contexts.find(context);
+  if (iterator == shard.contexts.end()) {
+    return nullptr;
+  }
+
+  ++shard.hits;
+  return *iterator;
+}
+
+Ref<PredictionContext> PredictionContextCache::getOrAdd(const Ref<PredictionContext> &context) {
+  Shard &shard = shardFor(*context);
+  std::lock_guard<std::mutex> lock(shard.lock);
+
+  auto result = shard.contexts.insert(context);
+  if (result.second) {
+    size_t size = estimateSize(*context);
+    shard.bytes += size;
+    _bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  return *result.first;
+}
+
+size_t PredictionContextCache::size() const {
+  size_t result = 0;
+  for (const Shard &shard : _shards) {
+    std::lock_guard<std::mutex> lock(shard.lock);
+    result += shard.contexts.size();
+  }
+  return result;
+}
+
+bool PredictionContextCache::empty() const {
+  return size() == 0;
+}
+
+void PredictionContextCache::clear() {
+  for (Shard &shard : _shards) {
+    // Release the contexts outside of the lock, freeing a large graph can take a while.
+    std::unordered_set<Ref<PredictionContext>, PredictionContextHasher, PredictionContextComparer> contexts;
+    {
+      std::lock_guard<std::mutex> lock(shard.lock);
+      contexts.swap(shard.contexts);
+      _bytes.fetch_sub(shard.bytes, std::memory_order_relaxed);
+      shard.bytes = 0;
+    }
+  }
+}
+
+PredictionContextCache::Statistics PredictionContextCache::getStatistics() const {
+  Statistics result = { 0, 0, 0, 0 };
+  for (const Shard &shard : _shards) {
+    std::lock_guard<std::mutex> lock(shard.lock);
+    result.nodeCount += shard.contexts.size();
+    result.bytes += shard.bytes + shard.contexts.bucket_count() * sizeof(void *);
+    result.lookups += shard.lookups;
+    result.hits += shard.hits;
+  }
+  return result;
+}
+
+void PredictionContextCache::setCapacity(size_t bytes) {
+  _capacity.store(bytes, std::memory_order_relaxed);
+}
+
+size_t PredictionContextCache::getCapacity() const {
+  return _capacity.load(std::memory_order_relaxed);
+}
+
+bool PredictionContextCache::isOverCapacity() const {
+  size_t capacity = _capacity.load(std::memory_order_relaxed);
+  return capacity > 0 && _bytes.load(std::memory_order_relaxed) > capacity;
+}
+
+PredictionContextCache::Shard& PredictionContextCache::shardFor(const PredictionContext &context) {
+  // The sets inside the shards use the low bits of the hash, so select the shard by some higher ones.
+  return _shards[(context.hashCode() >> 16) % SHARD_COUNT];
+}
+
+size_t PredictionContextCache::estimateSize(const PredictionContext &context) {
+  // On top of the context itself: its shared_ptr control block (vtable pointer and two counters) and a node of
+  // the hash set (next pointer, element and cached hash).
+  size_t size = 3 * sizeof(void *) + sizeof(void *) + sizeof(Ref<PredictionContext>) + sizeof(size_t);
+  if (context.size() == 1) {
+    size += sizeof(SingletonPredictionContext);
+  } else {
+    size += sizeof(ArrayPredictionContext) + context.size() * (sizeof(Ref<PredictionContext>) + sizeof(size_t));
+  }
+  return size;
+}
+
 //----------------- PredictionContextMergeCache ------------------------------------------------------------------------
 
 Ref<PredictionContext> PredictionContextMergeCache::put(Ref<PredictionContext> const& key1, Ref<PredictionContext> const& key2,
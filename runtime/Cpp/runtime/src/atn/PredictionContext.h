@@ -11,14 +11,15 @@
 
 #include "misc/MurmurHash.h"
 
+#include <atomic>
+
 namespace antlr4 {
 namespace atn {
 
   struct PredictionContextHasher;
   struct PredictionContextComparer;
   class PredictionContextMergeCache;
-
-  typedef std::unordered_set<Ref<PredictionContext>, PredictionContextHasher, PredictionContextComparer> PredictionContextCache;
+  class PredictionContextCache;
 
   class ANTLR4CPP_PUBLIC PredictionContext {
   public:
@@ -238,6 +239,69 @@ namespace atn {
     }
   };
 
+  /// Interns the prediction contexts of DFA states, so that equal contexts are stored only once. A cache is shared
+  /// by all simulators of a grammar and so by all threads parsing with it. It is split into shards with a lock
+  /// each, selected by context hash, which lets threads adding DFA states at the same time mostly proceed in
+  /// parallel.
+  ///
+  /// The cache never evicts anything on its own, since the DFA states keep their contexts alive anyway. Instead it
+  /// can be given a capacity, and ATNSimulator::purgeIfOverCapacity() drops the DFA together with the cache once
+  /// that is exceeded.
+  class ANTLR4CPP_PUBLIC PredictionContextCache {
+  public:
+    struct Statistics {
+      size_t nodeCount;
+      size_t bytes; // Estimated size of the cached contexts, including the cache's own overhead.
+      size_t lookups; // Calls of find().
+      size_t hits;
+
+      double hitRate() const {
+        return lookups == 0 ? 0 : static_cast<double>(hits) / static_cast<double>(lookups);
+      }
+    };
+
+    PredictionContextCache();
+    PredictionContextCache(const PredictionContextCache &other) = delete;
+
+    PredictionContextCache& operator = (const PredictionContextCache &other) = delete;
+
+    /// Returns the cached context which equals the given one, or null if there is none.
+    Ref<PredictionContext> find(const Ref<PredictionContext> &context);
+
+    /// Returns the cached context which equals the given one, after adding the given context if there was none.
+    Ref<PredictionContext> getOrAdd(const Ref<PredictionContext> &context);
+
+    size_t size() const;
+    bool empty() const;
+    void clear();
+
+    Statistics getStatistics() const;
+
+    /// The size in bytes (as estimated for Statistics::bytes) beyond which the cache is considered full.
+    /// 0 (the default) means no limit.
+    void setCapacity(size_t bytes);
+    size_t getCapacity() const;
+    bool isOverCapacity() const;
+
+  private:
+    static const size_t SHARD_COUNT = 16;
+
+    struct Shard {
+      mutable std::mutex lock;
+      std::unordered_set<Ref<PredictionContext>, PredictionContextHasher, PredictionContextComparer> contexts;
+      size_t bytes = 0;
+      size_t lookups = 0;
+      size_t hits = 0;
+    };
+
+    std::array<Shard, SHARD_COUNT> _shards;
+    std::atomic<size_t> _bytes; // The sum over all shards, for the capacity check without locking.
+    std::atomic<size_t> _capacity;
+
+    Shard& shardFor(const PredictionContext &context);
+    static size_t estimateSize(const PredictionContext &context);
+  };
+
   class PredictionContextMergeCache {
   public:
     Ref<PredictionContext> put(Ref<PredictionContext> const& key1, Ref<PredictionContext> const& key2,
@@ -101,7 +101,7 @@ bool PredictionModeClass::allSubsetsConflict(const std::vector<antlrcpp::BitSet>
 }
 
 bool PredictionModeClass::hasNonConflictingAltSet(const std::vector<antlrcpp::BitSet>& altsets) {
-  for (antlrcpp::BitSet alts : altsets) {
+  for (const antlrcpp::BitSet &alts : altsets) {
     if (alts.count() == 1) {
       return true;
     }
@@ -110,7 +110,7 @@ bool PredictionModeClass::hasNonConflictingAltSet(const std::vector<antlrcpp::Bi
 }
 
 bool PredictionModeClass::hasConflictingAltSet(const std::vector<antlrcpp::BitSet>& altsets) {
-  for (antlrcpp::BitSet alts : altsets) {
+  for (const antlrcpp::BitSet &alts : altsets) {
     if (alts.count() > 1) {
       return true;
     }
@@ -163,7 +163,8 @@ std::vector<antlrcpp::BitSet> PredictionModeClass::getConflictingAltSubsets(ATNC
     configToAlts[config.get()].setBit(config->alt);
   }
   std::vector<antlrcpp::BitSet> values;
-  for (auto it : configToAlts) {
+  values.reserve(configToAlts.size());
+  for (auto &it : configToAlts) {
     values.push_back(it.second);
   }
 
@@ -189,7 +190,7 @@ bool PredictionModeClass::hasStateAssociatedWithOneAlt(ATNConfigSet *configs) {
 
 size_t PredictionModeClass::getSingleViableAlt(const std::vector<antlrcpp::BitSet>& altsets) {
   antlrcpp::BitSet viableAlts;
-  for (antlrcpp::BitSet alts : altsets) {
+  for (const antlrcpp::BitSet &alts : altsets) {
     size_t minAlt = alts.nextSetBit(0);
 
     viableAlts.setBit(minAlt);
@@ -4,6 +4,7 @@
  */
 
 #include "atn/EmptyPredictionContext.h"
+#include "support/PoolAllocator.h"
 
 #include "atn/SingletonPredictionContext.h"
 
@@ -26,7 +27,7 @@ Ref<SingletonPredictionContext> SingletonPredictionContext::create(Ref<Predictio
     // someone can pass in the bits of an array ctx that mean $
     return std::dynamic_pointer_cast<SingletonPredictionContext>(EMPTY);
   }
-  return std::make_shared<SingletonPredictionContext>(parent, returnState);
+  return antlrcpp::makePooled<SingletonPredictionContext>(parent, returnState);
 }
 
 size_t SingletonPredictionContext::size() const {
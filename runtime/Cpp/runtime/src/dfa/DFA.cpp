@@ -7,7 +7,10 @@
 #include "dfa/LexerDFASerializer.h"
 #include "support/CPPUtils.h"
 #include "atn/StarLoopEntryState.h"
+#include "atn/TokensStartState.h"
 #include "atn/ATNConfigSet.h"
+#include "atn/LexerATNConfig.h"
+#include "dfa/LexerDFATable.h"
 
 #include "dfa/DFA.h"
 
@@ -15,11 +18,29 @@ using namespace antlr4;
 using namespace antlr4::dfa;
 using namespace antlrcpp;
 
+std::atomic<size_t> DFA::_useEpoch(1);
+
+namespace {
+
+  size_t configSetMemoryUsage(atn::ATNConfigSet &configs) {
+    if (configs.configs.empty()) {
+      return sizeof(atn::ATNConfigSet);
+    }
+
+    // Each config has its own allocation, shared with its shared_ptr control block.
+    size_t configSize = dynamic_cast<atn::LexerATNConfig *>(configs.configs[0].get()) != nullptr ?
+      sizeof(atn::LexerATNConfig) : sizeof(atn::ATNConfig);
+    return sizeof(atn::ATNConfigSet) + configs.configs.capacity() * sizeof(Ref<atn::ATNConfig>) +
+      configs.configs.size() * (configSize + 2 * sizeof(void *));
+  }
+
+}
+
 DFA::DFA(atn::DecisionState *atnStartState) : DFA(atnStartState, 0) {
 }
 
 DFA::DFA(atn::DecisionState *atnStartState, size_t decision)
-  : atnStartState(atnStartState), s0(nullptr), decision(decision) {
+  : atnStartState(atnStartState), s0(nullptr), decision(decision), _lastUse(0), _lexerTable(nullptr) {
 
   _precedenceDfa = false;
   if (is<atn::StarLoopEntryState *>(atnStartState)) {
@@ -42,6 +63,8 @@ DFA::DFA(DFA &&other) : atnStartState(other.atnStartState), decision(other.decis
   other.s0 = nullptr;
   _precedenceDfa = other._precedenceDfa;
   other._precedenceDfa = false;
+  _lastUse.store(other._lastUse.load());
+  _lexerTable.store(other._lexerTable.exchange(nullptr));
 }
 
 DFA::~DFA() {
@@ -54,6 +77,8 @@ DFA::~DFA() {
 
   if (!s0InList)
     delete s0;
+
+  delete _lexerTable.load();
 }
 
 bool DFA::isPrecedenceDfa() const {
@@ -63,14 +88,14 @@ bool DFA::isPrecedenceDfa() const {
 DFAState* DFA::getPrecedenceStartState(int precedence) const {
   assert(_precedenceDfa); // Only precedence DFAs may contain a precedence start state.
 
-  auto iterator = s0->edges.find(precedence);
-  if (iterator == s0->edges.end())
+  if (precedence < 0) {
     return nullptr;
+  }
 
-  return iterator->second;
+  return s0->edges.get((size_t)precedence);
 }
 
-void DFA::setPrecedenceStartState(int precedence, DFAState *startState, SingleWriteMultipleReadLock &lock) {
+void DFA::setPrecedenceStartState(int precedence, DFAState *startState) {
   if (!isPrecedenceDfa()) {
     throw IllegalStateException("Only precedence DFAs may contain a precedence start state.");
   }
@@ -79,17 +104,20 @@ void DFA::setPrecedenceStartState(int precedence, DFAState *startState, SingleWr
     return;
   }
 
-  {
-    lock.writeLock();
-    s0->edges[precedence] = startState;
-    lock.writeUnlock();
-  }
+  s0->edges.set((size_t)precedence, startState);
+}
+
+void DFA::setPrecedenceStartState(int precedence, DFAState *startState, SingleWriteMultipleReadLock &/*lock*/) {
+  setPrecedenceStartState(precedence, startState);
 }
 
 std::vector<DFAState *> DFA::getStates() const {
   std::vector<DFAState *> result;
-  for (auto state : states)
-    result.push_back(state);
+  {
+    std::lock_guard<std::mutex> lck(stateLock);
+    for (auto state : states)
+      result.push_back(state);
+  }
 
   std::sort(result.begin(), result.end(), [](DFAState *o1, DFAState *o2) -> bool {
     return o1->stateNumber < o2->stateNumber;
@@ -98,6 +126,93 @@ std::vector<DFAState *> DFA::getStates() const {
   return std::move(result);
 }
 
+DFA::Statistics DFA::getStatistics() const {
+  Statistics result = { decision, 0, 0, 0, 0, sizeof(DFA), _lastUse.load(std::memory_order_relaxed) };
+
+  auto addState = [&result](DFAState *state) {
+    size_t edgeCount = state->edges.size();
+    for (size_t i = 0; i < edgeCount; ++i) {
+      if (state->edges.get(i) != nullptr) {
+        ++result.edgeCount;
+      }
+    }
+
+    // The state itself plus its node in the state set.
+    result.bytes += sizeof(DFAState) + 3 * sizeof(void *) + state->edges.getMemoryUsage() +
+      state->predicates.size() * (sizeof(DFAState::PredPrediction) + sizeof(void *));
+    if (state->configs != nullptr) {
+      size_t configBytes = configSetMemoryUsage(*state->configs);
+      result.configCount += state->configs->configs.size();
+      result.configBytes += configBytes;
+      result.bytes += configBytes;
+    }
+  };
+
+  std::lock_guard<std::mutex> lock(stateLock);
+  result.stateCount = states.size();
+  for (DFAState *state : states) {
+    addState(state);
+  }
+  if (_precedenceDfa) {
+    addState(s0);
+  }
+
+  const LexerDFATable *table = getLexerTable();
+  if (table != nullptr) {
+    result.bytes += table->getMemoryUsage();
+  }
+
+  return result;
+}
+
+size_t DFA::releaseConfigs() {
+  if (is<atn::TokensStartState *>(atnStartState)) {
+    return 0; // A lexer DFA.
+  }
+
+  size_t result = 0;
+
+  // The lock keeps other threads from comparing with a state while its configs go away. Prediction itself
+  // never looks at the configs of the states in question.
+  std::lock_guard<std::mutex> lock(stateLock);
+  for (DFAState *state : states) {
+    if (state->configs != nullptr && state->isAcceptState && !state->requiresFullContext &&
+        state->predicates.empty() && state != s0) {
+      result += configSetMemoryUsage(*state->configs);
+      state->releaseConfigs();
+    }
+  }
+
+  return result;
+}
+
+void DFA::clear() {
+  std::lock_guard<std::mutex> lock(stateLock);
+  for (DFAState *state : states) {
+    delete state; // The start state of a precedence DFA is not in the set.
+  }
+  states.clear();
+
+  if (_precedenceDfa) {
+    s0->configs.reset(new atn::ATNConfigSet());
+    s0->edges.clear();
+  } else {
+    s0 = nullptr;
+  }
+}
+
+const LexerDFATable* DFA::setLexerTable(std::unique_ptr<LexerDFATable> table) {
+  const LexerDFATable *expected = nullptr;
+  if (_lexerTable.compare_exchange_strong(expected, table.get())) {
+    return table.release();
+  }
+  return expected; // Another thread was faster.
+}
+
+void DFA::advanceUseEpoch() {
+  _useEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
 std::string DFA::toString(const std::vector<std::string> &tokenNames) {
   if (s0 == nullptr) {
     return "";
@@ -7,6 +7,8 @@
 
 #include "dfa/DFAState.h"
 
+#include <atomic>
+
 namespace antlrcpp {
   class SingleWriteMultipleReadLock;
 }
@@ -16,6 +18,17 @@ namespace dfa {
 
   class ANTLR4CPP_PUBLIC DFA {
   public:
+    /// Memory use of a DFA. All sizes are estimates in bytes. Prediction contexts are not included, they live in
+    /// the PredictionContextCache shared by all DFAs of a grammar.
+    struct Statistics {
+      size_t decision;
+      size_t stateCount;
+      size_t edgeCount; // Edges which are set, including those to the error state.
+      size_t configCount; // ATN configs still held by the states.
+      size_t configBytes;
+      size_t bytes; // The whole DFA, including configBytes.
+      size_t lastUse; // The use epoch (see markUsed()) in which the DFA was last used.
+    };
     /// A set of all DFA states. Use a map so we can get old state back.
     /// Set only allows you to see if it's there.
 
@@ -26,6 +39,11 @@ namespace dfa {
     DFAState *s0;
     size_t decision;
 
+    /// Guards {@link #states} and the start state configuration of a precedence DFA. Every DFA has its own lock,
+    /// so simulators working on different decisions (or grammars) never contend. Following existing edges
+    /// needs no lock at all, see {@link DFAEdgeTable}.
+    mutable std::mutex stateLock;
+
     DFA(atn::DecisionState *atnStartState);
     DFA(atn::DecisionState *atnStartState, size_t decision);
     DFA(const DFA &other) = delete;
@@ -67,11 +85,50 @@ namespace dfa {
      * @throws IllegalStateException if this is not a precedence DFA.
      * @see #isPrecedenceDfa()
      */
+    void setPrecedenceStartState(int precedence, DFAState *startState);
+
+    /// @deprecated Edges are published without a lock now, use {@link #setPrecedenceStartState(int, DFAState *)} instead.
     void setPrecedenceStartState(int precedence, DFAState *startState, antlrcpp::SingleWriteMultipleReadLock &lock);
 
     /// Return a list of all states in this DFA, ordered by state number.
     virtual std::vector<DFAState *> getStates() const;
 
+    Statistics getStatistics() const;
+
+    /// Releases the config sets of all states which prediction doesn't need anymore and returns the number of
+    /// bytes this freed. That is the case for accept states of a parser DFA which neither need full context nor
+    /// have predicates: prediction ends when it reaches them, so it never computes edges leaving them. Not for
+    /// lexer DFAs, since the lexer goes on from accept states to find the longest match.
+    ///
+    /// Other threads may predict with the DFA meanwhile. Released states are not found anymore when an equal
+    /// state is added later, so that one is stored again (without affecting the results).
+    size_t releaseConfigs();
+
+    /// Removes all states, like creating the DFA anew. Like ATNSimulator::clearDFA(), this must only be called
+    /// while no other thread predicts with the DFA.
+    void clear();
+
+    /// The complete table of a lexer mode, if one was built (see atn::LexerATNSimulator::buildDFATables()).
+    const LexerDFATable* getLexerTable() const {
+      return _lexerTable.load(std::memory_order_acquire);
+    }
+
+    /// Installs the table of a lexer mode, unless there is one already. Returns the installed table. The table
+    /// is independent of the states, clear() keeps it.
+    const LexerDFATable* setLexerTable(std::unique_ptr<LexerDFATable> table);
+
+    /// Records that the DFA was used in the current use epoch. This is cheap enough to be called for each
+    /// prediction: it only writes if the epoch changed since the last call.
+    void markUsed() const {
+      size_t epoch = _useEpoch.load(std::memory_order_relaxed);
+      if (_lastUse.load(std::memory_order_relaxed) != epoch) {
+        _lastUse.store(epoch, std::memory_order_relaxed);
+      }
+    }
+
+    /// Starts a new use epoch, after which DFAs which were not used again are distinguishable as cold ones.
+    static void advanceUseEpoch();
+
     /**
      * @deprecated Use {@link #toString(Vocabulary)} instead.
      */
@@ -86,6 +143,11 @@ namespace dfa {
      * {@code false}. This is the backing field for {@link #isPrecedenceDfa}.
      */
     bool _precedenceDfa;
+
+    mutable std::atomic<size_t> _lastUse;
+    static std::atomic<size_t> _useEpoch;
+
+    std::atomic<const LexerDFATable *> _lexerTable;
   };
 
 } // namespace atn
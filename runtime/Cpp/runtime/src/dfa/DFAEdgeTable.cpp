@@ -0,0 +1,70 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "dfa/DFAEdgeTable.h"
+
+using namespace antlr4::dfa;
+
+DFAEdgeTable::Slots DFAEdgeTable::_emptySlots = { 0, nullptr, nullptr };
+
+DFAEdgeTable::DFAEdgeTable() : _slots(&_emptySlots) {
+}
+
+DFAEdgeTable::~DFAEdgeTable() {
+  clear();
+}
+
+void DFAEdgeTable::set(size_t index, DFAState *target, size_t capacity) {
+  Slots *slots = _slots.load(std::memory_order_acquire);
+  while (index >= slots->size) {
+    Slots *grown = new Slots(); /* mem-check: freed in clear() or below if another thread was faster */
+    grown->size = std::max(index + 1, capacity);
+    grown->targets = new std::atomic<DFAState *>[grown->size];
+    for (size_t i = 0; i < grown->size; ++i) {
+      grown->targets[i].store(i < slots->size ? slots->targets[i].load(std::memory_order_relaxed) : nullptr,
+        std::memory_order_relaxed);
+    }
+    grown->retired = slots == &_emptySlots ? nullptr : slots;
+
+    // On failure slots is updated to the array installed by the other thread and we try again with that.
+    if (_slots.compare_exchange_strong(slots, grown, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      slots = grown;
+    } else {
+      grown->retired = nullptr;
+      free(grown);
+    }
+  }
+
+  slots->targets[index].store(target, std::memory_order_release);
+}
+
+size_t DFAEdgeTable::size() const {
+  return _slots.load(std::memory_order_acquire)->size;
+}
+
+size_t DFAEdgeTable::getMemoryUsage() const {
+  size_t result = 0;
+  for (Slots *slots = _slots.load(std::memory_order_acquire); slots != &_emptySlots && slots != nullptr;
+       slots = slots->retired) {
+    result += sizeof(Slots) + slots->size * sizeof(std::atomic<DFAState *>);
+  }
+  return result;
+}
+
+void DFAEdgeTable::clear() {
+  Slots *slots = _slots.exchange(&_emptySlots);
+  if (slots != &_emptySlots) {
+    free(slots);
+  }
+}
+
+void DFAEdgeTable::free(Slots *slots) {
+  while (slots != nullptr) {
+    Slots *retired = slots->retired;
+    delete[] slots->targets;
+    delete slots;
+    slots = retired;
+  }
+}
@@ -0,0 +1,74 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+#include <atomic>
+
+namespace antlr4 {
+namespace dfa {
+
+  class DFAState;
+
+  /// The outgoing edges of a DFA state, stored as a flat array indexed by edge number.
+  ///
+  /// The simulators map their input symbols to a dense index range (the lexer uses
+  /// 0..MAX_DFA_EDGE, the parser shifts token types up by one so that EOF maps to 0) and
+  /// pass that range as capacity when adding the first edge. A lookup is then just a bounds
+  /// check and an array access instead of a tree search.
+  ///
+  /// Slots are atomic and are published with release semantics, so get() can run without
+  /// any lock while other threads add edges. A slot array is installed with compare-and-swap;
+  /// if a table must grow (only precedence DFAs index by a value which is not known up front)
+  /// the old slot array is kept alive until the table itself is destroyed, because readers
+  /// may still be looking at it. An edge written concurrently with a resize may get lost, which
+  /// is harmless: the edge is simply computed again the next time it is needed.
+  class ANTLR4CPP_PUBLIC DFAEdgeTable {
+  public:
+    DFAEdgeTable();
+    DFAEdgeTable(const DFAEdgeTable &other) = delete;
+    ~DFAEdgeTable();
+
+    DFAEdgeTable& operator = (const DFAEdgeTable &other) = delete;
+
+    /// Returns the target state for the given edge or null if that edge hasn't been computed yet.
+    DFAState* get(size_t index) const {
+      Slots *slots = _slots.load(std::memory_order_acquire);
+      if (index >= slots->size) {
+        return nullptr;
+      }
+      return slots->targets[index].load(std::memory_order_acquire);
+    }
+
+    /// Stores (or replaces) the target for the given edge. If the current slot array is too small
+    /// it is replaced by one with max(index + 1, capacity) entries. Safe to call from multiple threads.
+    void set(size_t index, DFAState *target, size_t capacity = 0);
+
+    /// The number of allocated slots. This is an upper bound for edge indexes, not the number of edges.
+    size_t size() const;
+
+    /// The memory used by the table in bytes, including arrays retired by growing the table.
+    size_t getMemoryUsage() const;
+
+    /// Removes all edges. Must not be called while other threads read this table.
+    void clear();
+
+  private:
+    struct Slots {
+      size_t size;
+      std::atomic<DFAState *> *targets;
+      Slots *retired; // The smaller array this one replaced, if any.
+    };
+
+    static Slots _emptySlots;
+
+    static void free(Slots *slots);
+
+    std::atomic<Slots *> _slots;
+  };
+
+} // namespace dfa
+} // namespace antlr4
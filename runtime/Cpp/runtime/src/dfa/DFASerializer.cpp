@@ -29,7 +29,7 @@ std::string DFASerializer::toString() const {
   std::vector<DFAState *> states = _dfa->getStates();
   for (auto s : states) {
     for (size_t i = 0; i < s->edges.size(); i++) {
-      DFAState *t = s->edges[i];
+      DFAState *t = s->edges.get(i);
       if (t != nullptr && t->stateNumber != INT32_MAX) {
         ss << getStateString(s);
         std::string label = getEdgeLabel(i);
@@ -42,7 +42,7 @@ std::string DFASerializer::toString() const {
 }
 
 std::string DFASerializer::getEdgeLabel(size_t i) const {
-  return _vocabulary.getDisplayName(i); // ml: no longer needed -1 as we use a map for edges, without offset.
+  return _vocabulary.getDisplayName(i - 1); // Edge 0 is EOF.
 }
 
 std::string DFASerializer::getStateString(DFAState *s) const {
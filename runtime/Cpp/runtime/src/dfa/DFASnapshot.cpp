@@ -0,0 +1,938 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "Exceptions.h"
+#include "atn/ATN.h"
+#include "atn/ATNSimulator.h"
+#include "atn/DecisionState.h"
+#include "atn/RuleTransition.h"
+#include "atn/PredicateTransition.h"
+#include "atn/PrecedencePredicateTransition.h"
+#include "atn/ActionTransition.h"
+#include "atn/LexerATNConfig.h"
+#include "atn/LexerActionExecutor.h"
+#include "atn/LexerIndexedCustomAction.h"
+#include "atn/OrderedATNConfigSet.h"
+#include "atn/EmptyPredictionContext.h"
+#include "atn/SingletonPredictionContext.h"
+#include "atn/ArrayPredictionContext.h"
+#include "atn/SemanticContext.h"
+#include "dfa/DFA.h"
+#include "misc/IntervalSet.h"
+#include "support/CPPUtils.h"
+#include "support/MappedFile.h"
+
+#include "dfa/DFASnapshot.h"
+
+#include <cstring>
+
+using namespace antlr4;
+using namespace antlr4::atn;
+using namespace antlr4::dfa;
+using namespace antlrcpp;
+
+namespace {
+
+  const char MAGIC[8] = { 'A', 'N', 'T', 'L', 'R', 'D', 'F', 'A' };
+  const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  // Ids referencing the snapshot's tables. All other ids are indices into the respective table.
+  const uint32_t NO_ID = 0xFFFFFFFF; // A null reference.
+  const uint32_t ERROR_ID = 0xFFFFFFFE; // ATNSimulator::ERROR (DFA edges only).
+  const uint32_t EMPTY_CONTEXT_ID = 0xFFFFFFFD; // PredictionContext::EMPTY.
+  const uint32_t NONE_SEMANTIC_ID = 0xFFFFFFFD; // SemanticContext::NONE.
+
+  enum SemanticKind : uint8_t {
+    PREDICATE, PRECEDENCE_PREDICATE, AND_OPERATOR, OR_OPERATOR
+  };
+
+  enum ContextKind : uint8_t {
+    SINGLETON_CONTEXT, ARRAY_CONTEXT
+  };
+
+  enum StateFlags : uint8_t {
+    ACCEPT_STATE = 1, REQUIRES_FULL_CONTEXT = 2
+  };
+
+  enum ConfigSetFlags : uint8_t {
+    FULL_CONTEXT = 1, HAS_SEMANTIC_CONTEXT = 2, DIPS_INTO_OUTER_CONTEXT = 4, LEXER_CONFIGS = 8
+  };
+
+  // FNV-1a, fed with 64 bit values.
+  class Checksum {
+  public:
+    uint64_t value = 14695981039346656037ULL;
+
+    void add(uint64_t v) {
+      for (size_t i = 0; i < 8; ++i) {
+        value ^= (v >> (i * 8)) & 0xFF;
+        value *= 1099511628211ULL;
+      }
+    }
+  };
+
+  class Writer {
+  public:
+    std::string buffer;
+
+    template<typename T>
+    void write(T value) {
+      buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void writeBool(bool value) {
+      write<uint8_t>(value ? 1 : 0);
+    }
+  };
+
+  class Reader {
+  public:
+    Reader(const char *data, size_t size) : _data(data), _end(data + size) {
+    }
+
+    template<typename T>
+    T read() {
+      if (static_cast<size_t>(_end - _data) < sizeof(T)) {
+        throw IllegalArgumentException("The DFA snapshot is truncated.");
+      }
+      T value;
+      std::memcpy(&value, _data, sizeof(T));
+      _data += sizeof(T);
+      return value;
+    }
+
+    bool readBool() {
+      return read<uint8_t>() != 0;
+    }
+
+    /// Reads a count of items, each of which takes at least itemSize bytes, so corrupt counts are caught before
+    /// anything is allocated for them.
+    size_t readCount(size_t itemSize) {
+      uint64_t count = read<uint64_t>();
+      if (count > static_cast<size_t>(_end - _data) / itemSize) {
+        throw IllegalArgumentException("The DFA snapshot is corrupt.");
+      }
+      return static_cast<size_t>(count);
+    }
+
+    bool atEnd() const {
+      return _data == _end;
+    }
+
+  private:
+    const char *_data;
+    const char *_end;
+  };
+
+  void corrupt() {
+    throw IllegalArgumentException("The DFA snapshot is corrupt.");
+  }
+
+  /// Collects the contexts and lexer action executors referenced by the DFA states while those are written,
+  /// and writes them into their own tables, which precede the DFAs in the snapshot.
+  class SnapshotWriter {
+  public:
+    Writer semanticTable;
+    Writer contextTable;
+    Writer executorTable;
+    Writer dfaData;
+
+    SnapshotWriter(const ATN &atn) : _atn(atn) {
+    }
+
+    size_t semanticCount() const {
+      return _semanticIds.size();
+    }
+
+    size_t contextCount() const {
+      return _contextIds.size();
+    }
+
+    size_t executorCount() const {
+      return _executorIds.size();
+    }
+
+    uint32_t semanticId(const Ref<SemanticContext> &context) {
+      if (context == nullptr) {
+        return NO_ID;
+      }
+      if (context == SemanticContext::NONE || *context == *SemanticContext::NONE) {
+        return NONE_SEMANTIC_ID;
+      }
+
+      auto iterator = _semanticIds.find(context.get());
+      if (iterator != _semanticIds.end()) {
+        return iterator->second;
+      }
+
+      // Operands first, so the loader always finds them already restored.
+      std::vector<uint32_t> operands;
+      SemanticKind kind;
+      if (is<SemanticContext::Predicate>(context)) {
+        kind = PREDICATE;
+      } else if (is<SemanticContext::PrecedencePredicate>(context)) {
+        kind = PRECEDENCE_PREDICATE;
+      } else {
+        auto op = std::dynamic_pointer_cast<SemanticContext::Operator>(context);
+        kind = is<SemanticContext::AND>(context) ? AND_OPERATOR : OR_OPERATOR;
+        for (auto &operand : op->getOperands()) {
+          operands.push_back(semanticId(operand));
+        }
+      }
+
+      semanticTable.write<uint8_t>(kind);
+      switch (kind) {
+        case PREDICATE: {
+          auto predicate = std::static_pointer_cast<SemanticContext::Predicate>(context);
+          semanticTable.write<uint64_t>(predicate->ruleIndex);
+          semanticTable.write<uint64_t>(predicate->predIndex);
+          semanticTable.writeBool(predicate->isCtxDependent);
+          break;
+        }
+
+        case PRECEDENCE_PREDICATE:
+          semanticTable.write<int32_t>(std::static_pointer_cast<SemanticContext::PrecedencePredicate>(context)->precedence);
+          break;
+
+        default:
+          semanticTable.write<uint64_t>(operands.size());
+          for (uint32_t operand : operands) {
+            semanticTable.write<uint32_t>(operand);
+          }
+          break;
+      }
+
+      uint32_t id = static_cast<uint32_t>(_semanticIds.size());
+      _semanticIds[context.get()] = id;
+      return id;
+    }
+
+    uint32_t contextId(const Ref<PredictionContext> &context) {
+      if (context == nullptr) {
+        return NO_ID;
+      }
+      if (context == PredictionContext::EMPTY || is<EmptyPredictionContext>(context)) {
+        return EMPTY_CONTEXT_ID;
+      }
+
+      auto iterator = _contextIds.find(context.get());
+      if (iterator != _contextIds.end()) {
+        return iterator->second;
+      }
+
+      size_t size = context->size();
+      std::vector<uint32_t> parents;
+      parents.reserve(size);
+      for (size_t i = 0; i < size; ++i) {
+        parents.push_back(contextId(context->getParent(i)));
+      }
+
+      bool singleton = is<SingletonPredictionContext>(context);
+      contextTable.write<uint8_t>(singleton ? SINGLETON_CONTEXT : ARRAY_CONTEXT);
+      if (!singleton) {
+        contextTable.write<uint64_t>(size);
+      }
+      for (size_t i = 0; i < size; ++i) {
+        contextTable.write<uint32_t>(parents[i]);
+        contextTable.write<uint64_t>(context->getReturnState(i));
+      }
+
+      uint32_t id = static_cast<uint32_t>(_contextIds.size());
+      _contextIds[context.get()] = id;
+      return id;
+    }
+
+    uint32_t executorId(const Ref<LexerActionExecutor> &executor) {
+      if (executor == nullptr) {
+        return NO_ID;
+      }
+
+      auto iterator = _executorIds.find(executor.get());
+      if (iterator != _executorIds.end()) {
+        return iterator->second;
+      }
+
+      std::vector<Ref<LexerAction>> actions = executor->getLexerActions();
+      executorTable.write<uint64_t>(actions.size());
+      for (auto &action : actions) {
+        int32_t offset = -1;
+        Ref<LexerAction> plainAction = action;
+        if (action->getActionType() == LexerActionType::CUSTOM && is<LexerIndexedCustomAction>(action)) {
+          auto indexed = std::static_pointer_cast<LexerIndexedCustomAction>(action);
+          offset = indexed->getOffset();
+          plainAction = indexed->getAction();
+        }
+        executorTable.write<uint32_t>(actionIndex(plainAction));
+        executorTable.write<int32_t>(offset);
+      }
+
+      uint32_t id = static_cast<uint32_t>(_executorIds.size());
+      _executorIds[executor.get()] = id;
+      return id;
+    }
+
+    void writeDFA(const DFA &dfa) {
+      std::vector<DFAState *> states;
+      DFAState *s0;
+      {
+        std::lock_guard<std::mutex> lock(dfa.stateLock);
+        for (DFAState *state : dfa.states) {
+          if (state->configs != nullptr) { // Released ones cannot be restored, edges to them are dropped.
+            states.push_back(state);
+          }
+        }
+        s0 = dfa.s0;
+      }
+
+      // Same order in each snapshot of the same DFA.
+      std::sort(states.begin(), states.end(), [](DFAState *lhs, DFAState *rhs) {
+        return lhs->stateNumber < rhs->stateNumber;
+      });
+
+      std::unordered_map<const DFAState *, uint32_t> stateIds;
+      for (size_t i = 0; i < states.size(); ++i) {
+        stateIds[states[i]] = static_cast<uint32_t>(i);
+      }
+
+      dfaData.write<uint64_t>(dfa.decision);
+      dfaData.writeBool(dfa.isPrecedenceDfa());
+      dfaData.write<uint64_t>(states.size());
+      for (DFAState *state : states) {
+        writeState(*state);
+      }
+
+      for (DFAState *state : states) {
+        writeEdges(*state, stateIds);
+      }
+
+      if (dfa.isPrecedenceDfa()) {
+        // The precedence start state is not part of the states set, only its edges matter.
+        dfaData.writeBool(s0 != nullptr);
+        if (s0 != nullptr) {
+          writeEdges(*s0, stateIds);
+        }
+      } else {
+        auto iterator = stateIds.find(s0);
+        dfaData.write<uint32_t>(iterator == stateIds.end() ? NO_ID : iterator->second);
+      }
+    }
+
+  private:
+    const ATN &_atn;
+    std::unordered_map<const SemanticContext *, uint32_t> _semanticIds;
+    std::unordered_map<const PredictionContext *, uint32_t> _contextIds;
+    std::unordered_map<const LexerActionExecutor *, uint32_t> _executorIds;
+
+    uint32_t actionIndex(const Ref<LexerAction> &action) {
+      for (size_t i = 0; i < _atn.lexerActions.size(); ++i) {
+        if (_atn.lexerActions[i] == action) {
+          return static_cast<uint32_t>(i);
+        }
+      }
+      for (size_t i = 0; i < _atn.lexerActions.size(); ++i) {
+        if (*_atn.lexerActions[i] == *action) {
+          return static_cast<uint32_t>(i);
+        }
+      }
+      throw IllegalStateException("A lexer action of the DFA is not part of the ATN.");
+    }
+
+    void writeState(const DFAState &state) {
+      uint8_t flags = 0;
+      if (state.isAcceptState) {
+        flags |= ACCEPT_STATE;
+      }
+      if (state.requiresFullContext) {
+        flags |= REQUIRES_FULL_CONTEXT;
+      }
+      dfaData.write<int32_t>(state.stateNumber);
+      dfaData.write<uint8_t>(flags);
+      dfaData.write<uint64_t>(state.prediction);
+      dfaData.write<uint32_t>(executorId(state.lexerActionExecutor));
+
+      dfaData.write<uint64_t>(state.predicates.size());
+      for (DFAState::PredPrediction *predicate : state.predicates) {
+        dfaData.write<uint32_t>(semanticId(predicate->pred));
+        dfaData.write<int32_t>(predicate->alt);
+      }
+
+      writeConfigs(*state.configs);
+    }
+
+    void writeConfigs(const ATNConfigSet &configs) {
+      bool lexer = !configs.configs.empty() && dynamic_cast<LexerATNConfig *>(configs.configs[0].get()) != nullptr;
+      uint8_t flags = 0;
+      if (configs.fullCtx) {
+        flags |= FULL_CONTEXT;
+      }
+      if (configs.hasSemanticContext) {
+        flags |= HAS_SEMANTIC_CONTEXT;
+      }
+      if (configs.dipsIntoOuterContext) {
+        flags |= DIPS_INTO_OUTER_CONTEXT;
+      }
+      if (lexer || dynamic_cast<const OrderedATNConfigSet *>(&configs) != nullptr) {
+        flags |= LEXER_CONFIGS;
+      }
+
+      dfaData.write<uint8_t>(flags);
+      dfaData.write<uint64_t>(configs.uniqueAlt);
+
+      dfaData.write<uint64_t>(configs.conflictingAlts.count());
+      for (size_t alt = configs.conflictingAlts.nextSetBit(0); alt != INVALID_INDEX;
+           alt = configs.conflictingAlts.nextSetBit(alt + 1)) {
+        dfaData.write<uint64_t>(alt);
+      }
+
+      dfaData.write<uint64_t>(configs.configs.size());
+      for (auto &config : configs.configs) {
+        dfaData.write<uint64_t>(config->state->stateNumber);
+        dfaData.write<uint64_t>(config->alt);
+        dfaData.write<uint32_t>(contextId(config->context));
+        dfaData.write<uint32_t>(semanticId(config->semanticContext));
+        dfaData.write<uint64_t>(config->reachesIntoOuterContext);
+        if ((flags & LEXER_CONFIGS) != 0) {
+          auto lexerConfig = std::static_pointer_cast<LexerATNConfig>(config);
+          dfaData.write<uint32_t>(executorId(lexerConfig->getLexerActionExecutor()));
+          dfaData.writeBool(lexerConfig->hasPassedThroughNonGreedyDecision());
+        }
+      }
+    }
+
+    void writeEdges(const DFAState &state, const std::unordered_map<const DFAState *, uint32_t> &stateIds) {
+      // Edges added by other threads after the states were collected may point to states not in the snapshot.
+      // They are left out, the loaded DFA simply computes them again.
+      std::vector<std::pair<uint64_t, uint32_t>> edges;
+      size_t size = state.edges.size();
+      for (size_t i = 0; i < size; ++i) {
+        DFAState *target = state.edges.get(i);
+        if (target == nullptr) {
+          continue;
+        }
+        if (target == ATNSimulator::ERROR.get()) {
+          edges.push_back({ i, ERROR_ID });
+        } else {
+          auto iterator = stateIds.find(target);
+          if (iterator != stateIds.end()) {
+            edges.push_back({ i, iterator->second });
+          }
+        }
+      }
+
+      dfaData.write<uint64_t>(edges.size());
+      for (auto &edge : edges) {
+        dfaData.write<uint64_t>(edge.first);
+        dfaData.write<uint32_t>(edge.second);
+      }
+    }
+  };
+
+  /// Restores the tables and DFAs of a snapshot. Nothing is handed over to the target DFAs before the entire
+  /// snapshot was read successfully.
+  class SnapshotReader {
+  public:
+    struct LoadedDFA {
+      std::vector<std::unique_ptr<DFAState>> states;
+      DFAState *s0 = nullptr;
+      std::vector<std::pair<size_t, DFAState *>> precedenceEdges;
+    };
+
+    std::vector<LoadedDFA> dfas;
+
+    SnapshotReader(Reader &reader, const ATN &atn, PredictionContextCache &contextCache)
+      : _reader(reader), _atn(atn), _contextCache(contextCache) {
+    }
+
+    void readSemanticTable() {
+      size_t count = _reader.readCount(1);
+      _semanticContexts.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        switch (_reader.read<uint8_t>()) {
+          case PREDICATE: {
+            size_t ruleIndex = static_cast<size_t>(_reader.read<uint64_t>());
+            size_t predIndex = static_cast<size_t>(_reader.read<uint64_t>());
+            bool isCtxDependent = _reader.readBool();
+            _semanticContexts.push_back(std::make_shared<SemanticContext::Predicate>(ruleIndex, predIndex,
+              isCtxDependent));
+            break;
+          }
+
+          case PRECEDENCE_PREDICATE:
+            _semanticContexts.push_back(std::make_shared<SemanticContext::PrecedencePredicate>(_reader.read<int32_t>()));
+            break;
+
+          case AND_OPERATOR: {
+            std::vector<Ref<SemanticContext>> operands = readOperands();
+            // The constructor normalizes its operands, the saved ones are already normalized.
+            auto context = std::make_shared<SemanticContext::AND>(operands.front(), operands.back());
+            context->opnds = std::move(operands);
+            _semanticContexts.push_back(context);
+            break;
+          }
+
+          case OR_OPERATOR: {
+            std::vector<Ref<SemanticContext>> operands = readOperands();
+            auto context = std::make_shared<SemanticContext::OR>(operands.front(), operands.back());
+            context->opnds = std::move(operands);
+            _semanticContexts.push_back(context);
+            break;
+          }
+
+          default:
+            corrupt();
+        }
+      }
+    }
+
+    void readContextTable() {
+      size_t count = _reader.readCount(1);
+      _contexts.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        Ref<PredictionContext> context;
+        switch (_reader.read<uint8_t>()) {
+          case SINGLETON_CONTEXT: {
+            Ref<PredictionContext> parent = contextFor(_reader.read<uint32_t>());
+            context = SingletonPredictionContext::create(parent, static_cast<size_t>(_reader.read<uint64_t>()));
+            break;
+          }
+
+          case ARRAY_CONTEXT: {
+            size_t size = _reader.readCount(sizeof(uint32_t) + sizeof(uint64_t));
+            ArrayPredictionContext::TPredictionContextContainer parents;
+            ArrayPredictionContext::TReturnStateContainer returnStates;
+            parents.reserve(size);
+            returnStates.reserve(size);
+            for (size_t j = 0; j < size; ++j) {
+              parents.push_back(contextFor(_reader.read<uint32_t>()));
+              returnStates.push_back(static_cast<size_t>(_reader.read<uint64_t>()));
+            }
+            context = ArrayPredictionContext::makePredictionContext(std::move(parents), std::move(returnStates));
+            break;
+          }
+
+          default:
+            corrupt();
+        }
+
+        // Share the contexts with those the simulator creates later on.
+        _contexts.push_back(_contextCache.getOrAdd(context));
+      }
+    }
+
+    void readExecutorTable() {
+      size_t count = _reader.readCount(sizeof(uint64_t));
+      _executors.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        size_t actionCount = _reader.readCount(sizeof(uint32_t) + sizeof(int32_t));
+        std::vector<Ref<LexerAction>> actions;
+        actions.reserve(actionCount);
+        for (size_t j = 0; j < actionCount; ++j) {
+          uint32_t index = _reader.read<uint32_t>();
+          int32_t offset = _reader.read<int32_t>();
+          if (index >= _atn.lexerActions.size()) {
+            corrupt();
+          }
+          if (offset < 0) {
+            actions.push_back(_atn.lexerActions[index]);
+          } else {
+            actions.push_back(std::make_shared<LexerIndexedCustomAction>(offset, _atn.lexerActions[index]));
+          }
+        }
+        _executors.push_back(std::make_shared<LexerActionExecutor>(actions));
+      }
+    }
+
+    void readDFA(const DFA &target) {
+      LoadedDFA dfa;
+      if (_reader.read<uint64_t>() != target.decision || _reader.readBool() != target.isPrecedenceDfa()) {
+        corrupt();
+      }
+
+      // Equal states would be merged by the DFA's state set, so they must not occur in a snapshot.
+      std::unordered_set<DFAState *, DFAState::Hasher, DFAState::Comparer> uniqueStates;
+      size_t count = _reader.readCount(1);
+      dfa.states.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        dfa.states.push_back(readState());
+        if (!uniqueStates.insert(dfa.states.back().get()).second) {
+          corrupt();
+        }
+      }
+
+      for (auto &state : dfa.states) {
+        for (auto &edge : readEdges(dfa)) {
+          state->edges.set(edge.first, edge.second);
+        }
+      }
+
+      if (target.isPrecedenceDfa()) {
+        if (_reader.readBool()) {
+          dfa.precedenceEdges = readEdges(dfa);
+        }
+      } else {
+        uint32_t s0 = _reader.read<uint32_t>();
+        if (s0 != NO_ID) {
+          if (s0 >= dfa.states.size()) {
+            corrupt();
+          }
+          dfa.s0 = dfa.states[s0].get();
+        }
+      }
+
+      dfas.push_back(std::move(dfa));
+    }
+
+  private:
+    // The largest edge index the simulators use: the lexer indexes by code point, the parser by token type and
+    // precedence DFAs by precedence level. Anything beyond is corrupt data and must not be allocated.
+    static const size_t MAX_EDGE_INDEX = 0x110000;
+
+    Reader &_reader;
+    const ATN &_atn;
+    PredictionContextCache &_contextCache;
+    std::vector<Ref<SemanticContext>> _semanticContexts;
+    std::vector<Ref<PredictionContext>> _contexts;
+    std::vector<Ref<LexerActionExecutor>> _executors;
+
+    std::vector<Ref<SemanticContext>> readOperands() {
+      size_t count = _reader.readCount(sizeof(uint32_t));
+      if (count == 0) {
+        corrupt();
+      }
+
+      std::vector<Ref<SemanticContext>> operands;
+      operands.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        operands.push_back(semanticContextFor(_reader.read<uint32_t>()));
+      }
+      return operands;
+    }
+
+    Ref<SemanticContext> semanticContextFor(uint32_t id) {
+      if (id == NONE_SEMANTIC_ID) {
+        return SemanticContext::NONE;
+      }
+      if (id >= _semanticContexts.size()) {
+        corrupt();
+      }
+      return _semanticContexts[id];
+    }
+
+    Ref<PredictionContext> contextFor(uint32_t id) {
+      if (id == NO_ID) {
+        return nullptr;
+      }
+      if (id == EMPTY_CONTEXT_ID) {
+        return PredictionContext::EMPTY;
+      }
+      if (id >= _contexts.size()) {
+        corrupt();
+      }
+      return _contexts[id];
+    }
+
+    Ref<LexerActionExecutor> executorFor(uint32_t id) {
+      if (id == NO_ID) {
+        return nullptr;
+      }
+      if (id >= _executors.size()) {
+        corrupt();
+      }
+      return _executors[id];
+    }
+
+    std::unique_ptr<DFAState> readState() {
+      int stateNumber = _reader.read<int32_t>();
+      uint8_t flags = _reader.read<uint8_t>();
+      size_t prediction = static_cast<size_t>(_reader.read<uint64_t>());
+      Ref<LexerActionExecutor> lexerActionExecutor = executorFor(_reader.read<uint32_t>());
+
+      std::vector<std::pair<Ref<SemanticContext>, int>> predicates;
+      size_t predicateCount = _reader.readCount(sizeof(uint32_t) + sizeof(int32_t));
+      predicates.reserve(predicateCount);
+      for (size_t i = 0; i < predicateCount; ++i) {
+        Ref<SemanticContext> pred = semanticContextFor(_reader.read<uint32_t>());
+        predicates.push_back({ pred, _reader.read<int32_t>() });
+      }
+
+      std::unique_ptr<DFAState> state(new DFAState(readConfigs())); /* mem-check: managed by the target DFA once loaded */
+      state->stateNumber = stateNumber;
+      state->isAcceptState = (flags & ACCEPT_STATE) != 0;
+      state->requiresFullContext = (flags & REQUIRES_FULL_CONTEXT) != 0;
+      state->prediction = prediction;
+      state->lexerActionExecutor = std::move(lexerActionExecutor);
+      for (auto &predicate : predicates) {
+        state->predicates.push_back(new DFAState::PredPrediction(predicate.first, predicate.second)); /* mem-check: freed by the DFAState */
+      }
+      return state;
+    }
+
+    std::unique_ptr<ATNConfigSet> readConfigs() {
+      uint8_t flags = _reader.read<uint8_t>();
+      bool lexer = (flags & LEXER_CONFIGS) != 0;
+
+      std::unique_ptr<ATNConfigSet> configs;
+      if (lexer) {
+        configs.reset(new OrderedATNConfigSet());
+      } else {
+        configs.reset(new ATNConfigSet((flags & FULL_CONTEXT) != 0));
+      }
+      configs->hasSemanticContext = (flags & HAS_SEMANTIC_CONTEXT) != 0;
+      configs->dipsIntoOuterContext = (flags & DIPS_INTO_OUTER_CONTEXT) != 0;
+      configs->uniqueAlt = static_cast<size_t>(_reader.read<uint64_t>());
+
+      size_t conflictCount = _reader.readCount(sizeof(uint64_t));
+      for (size_t i = 0; i < conflictCount; ++i) {
+        uint64_t alt = _reader.read<uint64_t>();
+        if (alt >= antlrcpp::BitSet::BIT_CAPACITY) {
+          corrupt();
+        }
+        configs->conflictingAlts.setBit(static_cast<size_t>(alt));
+      }
+
+      size_t count = _reader.readCount(2 * sizeof(uint64_t) + 2 * sizeof(uint32_t) + sizeof(uint64_t));
+      configs->configs.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        uint64_t stateNumber = _reader.read<uint64_t>();
+        if (stateNumber >= _atn.states.size() || _atn.states[static_cast<size_t>(stateNumber)] == nullptr) {
+          corrupt();
+        }
+        ATNState *state = _atn.states[static_cast<size_t>(stateNumber)];
+        size_t alt = static_cast<size_t>(_reader.read<uint64_t>());
+        Ref<PredictionContext> context = contextFor(_reader.read<uint32_t>());
+        Ref<SemanticContext> semanticContext = semanticContextFor(_reader.read<uint32_t>());
+        size_t reachesIntoOuterContext = static_cast<size_t>(_reader.read<uint64_t>());
+
+        Ref<ATNConfig> config;
+        if (lexer) {
+          Ref<LexerActionExecutor> executor = executorFor(_reader.read<uint32_t>());
+          bool passedThroughNonGreedyDecision = _reader.readBool();
+          config = std::make_shared<LexerATNConfig>(state, static_cast<int>(alt), context, executor,
+            passedThroughNonGreedyDecision);
+          config->semanticContext = semanticContext;
+        } else {
+          config = std::make_shared<ATNConfig>(state, alt, context, semanticContext);
+        }
+        config->reachesIntoOuterContext = reachesIntoOuterContext;
+        configs->configs.push_back(std::move(config));
+      }
+
+      configs->setReadonly(true);
+      return configs;
+    }
+
+    std::vector<std::pair<size_t, DFAState *>> readEdges(const LoadedDFA &dfa) {
+      size_t count = _reader.readCount(sizeof(uint64_t) + sizeof(uint32_t));
+      std::vector<std::pair<size_t, DFAState *>> edges;
+      edges.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        uint64_t index = _reader.read<uint64_t>();
+        uint32_t target = _reader.read<uint32_t>();
+        if (index > MAX_EDGE_INDEX) {
+          corrupt();
+        }
+
+        if (target == ERROR_ID) {
+          edges.push_back({ static_cast<size_t>(index), ATNSimulator::ERROR.get() });
+        } else {
+          if (target >= dfa.states.size()) {
+            corrupt();
+          }
+          edges.push_back({ static_cast<size_t>(index), dfa.states[target].get() });
+        }
+      }
+      return edges;
+    }
+  };
+
+  void addLabel(Checksum &checksum, const misc::IntervalSet &set) {
+    checksum.add(set.getIntervals().size());
+    for (auto &interval : set.getIntervals()) {
+      checksum.add(static_cast<uint64_t>(interval.a));
+      checksum.add(static_cast<uint64_t>(interval.b));
+    }
+  }
+
+} // namespace
+
+//------------------ DFASnapshot ---------------------------------------------------------------------------------------
+
+std::string DFASnapshot::save(const ATN &atn, const std::vector<DFA> &decisionToDFA) {
+  SnapshotWriter writer(atn);
+  for (const DFA &dfa : decisionToDFA) {
+    writer.writeDFA(dfa);
+  }
+
+  Writer snapshot;
+  snapshot.buffer.append(MAGIC, sizeof(MAGIC));
+  snapshot.write<uint32_t>(VERSION);
+  snapshot.write<uint32_t>(BYTE_ORDER_MARK);
+  snapshot.write<uint64_t>(checksum(atn));
+
+  snapshot.write<uint64_t>(writer.semanticCount());
+  snapshot.buffer += writer.semanticTable.buffer;
+  snapshot.write<uint64_t>(writer.contextCount());
+  snapshot.buffer += writer.contextTable.buffer;
+  snapshot.write<uint64_t>(writer.executorCount());
+  snapshot.buffer += writer.executorTable.buffer;
+  snapshot.write<uint64_t>(decisionToDFA.size());
+  snapshot.buffer += writer.dfaData.buffer;
+
+  return snapshot.buffer;
+}
+
+void DFASnapshot::save(const std::string &fileName, const ATN &atn, const std::vector<DFA> &decisionToDFA) {
+  std::string snapshot = save(atn, decisionToDFA);
+
+  std::ofstream stream(fileName, std::ios::binary | std::ios::trunc);
+  if (!stream.is_open()) {
+    throw IOException("Cannot open file " + fileName);
+  }
+  stream.write(snapshot.data(), static_cast<std::streamsize>(snapshot.size()));
+  stream.close();
+  if (stream.fail()) {
+    throw IOException("Cannot write file " + fileName);
+  }
+}
+
+bool DFASnapshot::load(const char *data, size_t size, const ATN &atn, std::vector<DFA> &decisionToDFA,
+  PredictionContextCache &contextCache) {
+  for (const DFA &dfa : decisionToDFA) {
+    std::lock_guard<std::mutex> lock(dfa.stateLock);
+    if (!dfa.states.empty()) {
+      throw IllegalStateException("A DFA snapshot can only be loaded into empty DFAs.");
+    }
+  }
+
+  Reader reader(data, size);
+  char magic[sizeof(MAGIC)];
+  for (char &c : magic) {
+    c = reader.read<char>();
+  }
+  if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw IllegalArgumentException("The data is not a DFA snapshot.");
+  }
+
+  // A snapshot written by another version or on a machine with a different byte order is just outdated.
+  if (reader.read<uint32_t>() != VERSION || reader.read<uint32_t>() != BYTE_ORDER_MARK
+      || reader.read<uint64_t>() != checksum(atn)) {
+    return false;
+  }
+
+  SnapshotReader snapshot(reader, atn, contextCache);
+  snapshot.readSemanticTable();
+  snapshot.readContextTable();
+  snapshot.readExecutorTable();
+
+  if (reader.read<uint64_t>() != decisionToDFA.size()) {
+    corrupt();
+  }
+  for (const DFA &dfa : decisionToDFA) {
+    snapshot.readDFA(dfa);
+  }
+  if (!reader.atEnd()) {
+    corrupt();
+  }
+
+  for (size_t i = 0; i < decisionToDFA.size(); ++i) {
+    DFA &dfa = decisionToDFA[i];
+    SnapshotReader::LoadedDFA &loaded = snapshot.dfas[i];
+
+    std::lock_guard<std::mutex> lock(dfa.stateLock);
+    for (auto &state : loaded.states) {
+      dfa.states.insert(state.release());
+    }
+    if (dfa.isPrecedenceDfa()) {
+      for (auto &edge : loaded.precedenceEdges) {
+        dfa.s0->edges.set(edge.first, edge.second);
+      }
+    } else {
+      dfa.s0 = loaded.s0;
+    }
+  }
+
+  return true;
+}
+
+bool DFASnapshot::load(const std::string &fileName, const ATN &atn, std::vector<DFA> &decisionToDFA,
+  PredictionContextCache &contextCache) {
+  antlrcpp::MappedFile file(fileName, true);
+  return load(file.data(), file.size(), atn, decisionToDFA, contextCache);
+}
+
+uint64_t DFASnapshot::checksum(const ATN &atn) {
+  Checksum checksum;
+  checksum.add(static_cast<uint64_t>(atn.grammarType));
+  checksum.add(atn.maxTokenType);
+
+  checksum.add(atn.states.size());
+  for (ATNState *state : atn.states) {
+    if (state == nullptr) {
+      checksum.add(ATNState::ATN_INVALID_TYPE);
+      continue;
+    }
+
+    checksum.add(state->getStateType());
+    checksum.add(state->ruleIndex);
+    checksum.add(state->transitions.size());
+    for (Transition *transition : state->transitions) {
+      checksum.add(transition->getSerializationType());
+      checksum.add(transition->target->stateNumber);
+
+      switch (transition->getSerializationType()) {
+        case Transition::ATOM:
+        case Transition::RANGE:
+        case Transition::SET:
+        case Transition::NOT_SET:
+          addLabel(checksum, transition->label());
+          break;
+
+        case Transition::RULE: {
+          RuleTransition *ruleTransition = static_cast<RuleTransition *>(transition);
+          checksum.add(ruleTransition->ruleIndex);
+          checksum.add(static_cast<uint64_t>(ruleTransition->precedence));
+          checksum.add(ruleTransition->followState->stateNumber);
+          break;
+        }
+
+        case Transition::PREDICATE: {
+          PredicateTransition *predicateTransition = static_cast<PredicateTransition *>(transition);
+          checksum.add(predicateTransition->ruleIndex);
+          checksum.add(predicateTransition->predIndex);
+          checksum.add(predicateTransition->isCtxDependent ? 1 : 0);
+          break;
+        }
+
+        case Transition::PRECEDENCE:
+          checksum.add(static_cast<uint64_t>(static_cast<PrecedencePredicateTransition *>(transition)->precedence));
+          break;
+
+        case Transition::ACTION: {
+          ActionTransition *actionTransition = static_cast<ActionTransition *>(transition);
+          checksum.add(actionTransition->ruleIndex);
+          checksum.add(actionTransition->actionIndex);
+          checksum.add(actionTransition->isCtxDependent ? 1 : 0);
+          break;
+        }
+
+        default:
+          break;
+      }
+    }
+  }
+
+  checksum.add(atn.decisionToState.size());
+  for (DecisionState *state : atn.decisionToState) {
+    checksum.add(state->stateNumber);
+  }
+
+  checksum.add(atn.lexerActions.size());
+  for (auto &action : atn.lexerActions) {
+    checksum.add(static_cast<uint64_t>(action->getActionType()));
+    checksum.add(action->hashCode());
+  }
+
+  return checksum.value;
+}
@@ -0,0 +1,59 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "atn/PredictionContext.h"
+
+namespace antlr4 {
+namespace dfa {
+
+  /// Saves the DFA cache of a parser or lexer (its decisionToDFA vector) in a binary snapshot and loads it
+  /// again, e.g. in a new process. A freshly started process has to build its DFAs from scratch, which makes
+  /// prediction many times slower for a while. Loading a snapshot taken from a warmed up process avoids that.
+  ///
+  /// A snapshot contains all DFA states with their edges, accept/predicate info and config sets (which are
+  /// needed to add new edges later), plus the prediction contexts and semantic contexts they reference.
+  /// States without configs (see DFA::releaseConfigs()) are left out, prediction creates them again when needed.
+  /// It is tied to the ATN it was taken from (by a checksum over the ATN structure) and to the snapshot
+  /// format version. Snapshots use the byte order of the machine which wrote them.
+  ///
+  /// Typical use for a parser (the same works for lexers, with LexerATNSimulator::getDecisionToDFA()):
+  ///
+  ///   auto *simulator = parser.getInterpreter<atn::ParserATNSimulator>();
+  ///   dfa::DFASnapshot::load("parser.dfa", parser.getATN(), simulator->decisionToDFA, simulator->getSharedContextCache());
+  ///   ... parse ...
+  ///   dfa::DFASnapshot::save("parser.dfa", parser.getATN(), simulator->decisionToDFA);
+  ///
+  /// Loading must happen before any prediction was done with the DFAs. Saving may happen at any time, also
+  /// while other threads parse with the same DFAs.
+  class ANTLR4CPP_PUBLIC DFASnapshot {
+  public:
+    static const uint32_t VERSION = 1;
+
+    /// Returns the snapshot of the given DFAs, which must belong to the given ATN.
+    static std::string save(const atn::ATN &atn, const std::vector<DFA> &decisionToDFA);
+
+    /// Writes the snapshot to the given file. Throws an IOException if the file cannot be written.
+    static void save(const std::string &fileName, const atn::ATN &atn, const std::vector<DFA> &decisionToDFA);
+
+    /// Restores the DFAs from a snapshot. Returns false (and leaves the DFAs alone) if the snapshot was taken
+    /// for a different ATN or with another format version. Throws an IllegalArgumentException if the data
+    /// is corrupt and an IllegalStateException if the DFAs are not empty.
+    /// The restored prediction contexts are merged into contextCache.
+    static bool load(const char *data, size_t size, const atn::ATN &atn, std::vector<DFA> &decisionToDFA,
+      atn::PredictionContextCache &contextCache);
+
+    /// Restores the DFAs from a snapshot file, which is memory mapped for that. Throws an IOException if the
+    /// file cannot be read, otherwise the same as above.
+    static bool load(const std::string &fileName, const atn::ATN &atn, std::vector<DFA> &decisionToDFA,
+      atn::PredictionContextCache &contextCache);
+
+    /// A checksum over the structure of the given ATN, which identifies the grammar a snapshot belongs to.
+    static uint64_t checksum(const atn::ATN &atn);
+  };
+
+} // namespace dfa
+} // namespace antlr4
@@ -57,7 +57,18 @@ std::set<size_t> DFAState::getAltSet() {
   return std::move(alts);
 }
 
+void DFAState::releaseConfigs() {
+  if (configs != nullptr) {
+    _releasedHashCode = hashCode();
+    configs.reset();
+  }
+}
+
 size_t DFAState::hashCode() const {
+  if (configs == nullptr) {
+    return _releasedHashCode;
+  }
+
   size_t hash = misc::MurmurHash::initialize(7);
   hash = misc::MurmurHash::update(hash, configs->hashCode());
   hash = misc::MurmurHash::finish(hash, 1);
@@ -66,6 +77,9 @@ size_t DFAState::hashCode() const {
 
 bool DFAState::operator < (const DFAState& rhs) const
   {
+  if (configs == nullptr || rhs.configs == nullptr) {
+    return stateNumber < rhs.stateNumber;
+  }
   return *configs < *rhs.configs;
   }
 
@@ -75,6 +89,9 @@ bool DFAState::operator == (const DFAState &o) const {
     return true;
   }
 
+  if (configs == nullptr || o.configs == nullptr) {
+    return false;
+  }
   return *configs == *o.configs;
 }
 
@@ -102,4 +119,5 @@ void DFAState::InitializeInstanceFields() {
   isAcceptState = false;
   prediction = 0;
   requiresFullContext = false;
+  _releasedHashCode = 0;
 }
@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "antlr4-common.h"
+#include "dfa/DFAEdgeTable.h"
 
 namespace antlr4 {
 namespace dfa {
@@ -57,9 +57,8 @@ namespace dfa {
 
     /// {@code edges[symbol]} points to target of symbol. Shift up by 1 so (-1)
     ///  <seealso cref="Token#EOF"/> maps to {@code edges[0]}.
-    // ml: this is a sparse list, so we use a map instead of a vector.
-    //     Watch out: we no longer have the -1 offset, as it isn't needed anymore.
-    std::map<size_t, DFAState *> edges;
+    // ml: the lexer doesn't need the shift, it stores edges for 0..MAX_DFA_EDGE, followed by character classes.
+    DFAEdgeTable edges;
 
     /// if accept state, what ttype do we match or alt do we predict?
     /// This is set to <seealso cref="ATN#INVALID_ALT_NUMBER"/> when <seealso cref="#predicates"/>{@code !=null} or
@@ -105,6 +104,11 @@ namespace dfa {
     /// </summary>
     virtual std::set<size_t> getAltSet();
 
+    /// Frees the config set, which is only needed to compute new edges and to find equal states. The state keeps
+    /// its hash code, so it can stay in the DFA's state set, but afterwards it only equals itself.
+    /// See DFA::releaseConfigs() for the states where this is possible.
+    void releaseConfigs();
+
     virtual size_t hashCode() const;
 
     /// \see operator== comment.
@@ -147,6 +151,8 @@ namespace dfa {
     };
 
   private:
+    size_t _releasedHashCode; // The hash code from before the configs were released.
+
     void InitializeInstanceFields();
   };
 
@@ -4,6 +4,7 @@
  */
 
 #include "Vocabulary.h"
+#include "atn/LexerATNSimulator.h"
 
 #include "dfa/LexerDFASerializer.h"
 
@@ -16,5 +17,8 @@ LexerDFASerializer::~LexerDFASerializer() {
 }
 
 std::string LexerDFASerializer::getEdgeLabel(size_t i) const {
+  if (i > atn::LexerATNSimulator::MAX_DFA_EDGE) {
+    return "class " + std::to_string(i - atn::LexerATNSimulator::MAX_DFA_EDGE - 1);
+  }
   return std::string("'") + static_cast<char>(i) + "'";
 }
@@ -0,0 +1,111 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "atn/LexerActionExecutor.h"
+
+#include "dfa/LexerDFATable.h"
+
+using namespace antlr4;
+using namespace antlr4::dfa;
+
+const uint32_t LexerDFATable::ERROR_STATE;
+
+LexerDFATable::LexerDFATable(size_t stateCount, size_t columnCount)
+  : _columnCount(columnCount), _transitions(stateCount * columnCount, ERROR_STATE),
+    _predictions(stateCount, INVALID_INDEX), _lexerActionExecutors(stateCount) {
+}
+
+size_t LexerDFATable::getStateCount() const {
+  return _predictions.size();
+}
+
+size_t LexerDFATable::getColumnCount() const {
+  return _columnCount;
+}
+
+void LexerDFATable::setTarget(uint32_t state, size_t column, uint32_t target) {
+  _transitions[state * _columnCount + column] = target;
+}
+
+void LexerDFATable::setAccept(uint32_t state, size_t prediction,
+  const Ref<atn::LexerActionExecutor> &lexerActionExecutor) {
+  _predictions[state] = prediction;
+  _lexerActionExecutors[state] = lexerActionExecutor;
+}
+
+std::unique_ptr<LexerDFATable> LexerDFATable::minimize() const {
+  size_t stateCount = getStateCount();
+
+  // Start with one block per distinct accept behavior and split blocks as long as some of their states
+  // lead to different blocks for the same column (Moore's algorithm). Blocks are numbered in the order of
+  // their first state, so the start state stays state 0.
+  std::vector<uint32_t> blocks(stateCount);
+  std::vector<uint32_t> representatives;
+  for (uint32_t state = 0; state < stateCount; ++state) {
+    size_t block = 0;
+    for (; block < representatives.size(); ++block) {
+      uint32_t other = representatives[block];
+      if (_predictions[state] != _predictions[other]) {
+        continue;
+      }
+
+      const Ref<atn::LexerActionExecutor> &executor = _lexerActionExecutors[state];
+      const Ref<atn::LexerActionExecutor> &otherExecutor = _lexerActionExecutors[other];
+      if (executor == otherExecutor || (executor != nullptr && otherExecutor != nullptr && *executor == *otherExecutor)) {
+        break;
+      }
+    }
+
+    if (block == representatives.size()) {
+      representatives.push_back(state);
+    }
+    blocks[state] = static_cast<uint32_t>(block);
+  }
+
+  size_t blockCount = representatives.size();
+  std::vector<uint32_t> signature(_columnCount + 1);
+  while (true) {
+    std::map<std::vector<uint32_t>, uint32_t> signatures;
+    std::vector<uint32_t> refined(stateCount);
+    representatives.clear();
+    for (uint32_t state = 0; state < stateCount; ++state) {
+      signature[0] = blocks[state];
+      for (size_t column = 0; column < _columnCount; ++column) {
+        uint32_t target = getTarget(state, column);
+        signature[column + 1] = target == ERROR_STATE ? ERROR_STATE : blocks[target];
+      }
+
+      auto result = signatures.insert({ signature, static_cast<uint32_t>(signatures.size()) });
+      if (result.second) {
+        representatives.push_back(state);
+      }
+      refined[state] = result.first->second;
+    }
+
+    // Blocks are only ever split, so an unchanged count means nothing was split.
+    blocks.swap(refined);
+    if (signatures.size() == blockCount) {
+      break;
+    }
+    blockCount = signatures.size();
+  }
+
+  std::unique_ptr<LexerDFATable> result(new LexerDFATable(blockCount, _columnCount)); /* mem-check: managed by unique_ptr */
+  for (uint32_t block = 0; block < blockCount; ++block) {
+    uint32_t state = representatives[block];
+    for (size_t column = 0; column < _columnCount; ++column) {
+      uint32_t target = getTarget(state, column);
+      result->setTarget(block, column, target == ERROR_STATE ? ERROR_STATE : blocks[target]);
+    }
+    result->setAccept(block, _predictions[state], _lexerActionExecutors[state]);
+  }
+
+  return result;
+}
+
+size_t LexerDFATable::getMemoryUsage() const {
+  return sizeof(LexerDFATable) + _transitions.capacity() * sizeof(uint32_t) + _predictions.capacity() * sizeof(size_t) +
+    _lexerActionExecutors.capacity() * sizeof(Ref<atn::LexerActionExecutor>);
+}
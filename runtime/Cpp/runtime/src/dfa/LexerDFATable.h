@@ -0,0 +1,79 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlr4 {
+namespace atn {
+  class LexerActionExecutor;
+}
+
+namespace dfa {
+
+  /// The complete DFA of one lexer mode as a transition table, see LexerATNSimulator::buildDFATables().
+  ///
+  /// Each row is a state, each column an input symbol: first the code points 0..LexerATNSimulator::MAX_DFA_EDGE,
+  /// then the character classes (see atn::CompiledATN::getCharClass()) and last EOF. Unlike a DFA, which is
+  /// extended while lexing, a table is complete and immutable, so it can be used by many threads without any
+  /// synchronization. State 0 is the start state.
+  class ANTLR4CPP_PUBLIC LexerDFATable {
+  public:
+    /// The target of transitions on which no token can be continued.
+    static const uint32_t ERROR_STATE = 0xFFFFFFFF;
+
+    /// Creates a table where all transitions lead to ERROR_STATE and no state accepts.
+    LexerDFATable(size_t stateCount, size_t columnCount);
+    LexerDFATable(const LexerDFATable &other) = delete;
+
+    LexerDFATable& operator = (const LexerDFATable &other) = delete;
+
+    size_t getStateCount() const;
+    size_t getColumnCount() const;
+
+    /// The column for EOF.
+    size_t getEofColumn() const {
+      return _columnCount - 1;
+    }
+
+    uint32_t getTarget(uint32_t state, size_t column) const {
+      return _transitions[state * _columnCount + column];
+    }
+
+    void setTarget(uint32_t state, size_t column, uint32_t target);
+
+    bool isAcceptState(uint32_t state) const {
+      return _predictions[state] != INVALID_INDEX;
+    }
+
+    /// The token type of an accept state.
+    size_t getPrediction(uint32_t state) const {
+      return _predictions[state];
+    }
+
+    /// The actions to execute when a token ends in the given accept state (possibly null).
+    const Ref<atn::LexerActionExecutor>& getLexerActionExecutor(uint32_t state) const {
+      return _lexerActionExecutors[state];
+    }
+
+    void setAccept(uint32_t state, size_t prediction, const Ref<atn::LexerActionExecutor> &lexerActionExecutor);
+
+    /// Returns the equivalent table with the minimal number of states, merging states which accept the same
+    /// way and have equivalent transitions for all columns.
+    std::unique_ptr<LexerDFATable> minimize() const;
+
+    /// The memory used by the table in bytes.
+    size_t getMemoryUsage() const;
+
+  private:
+    size_t _columnCount;
+    std::vector<uint32_t> _transitions; // Row major.
+    std::vector<size_t> _predictions; // INVALID_INDEX for states which don't accept.
+    std::vector<Ref<atn::LexerActionExecutor>> _lexerActionExecutors;
+  };
+
+} // namespace dfa
+} // namespace antlr4
@@ -9,8 +9,5 @@ using namespace antlrcpp;
 
 Any::~Any()
 {
-    delete _ptr;
-}
-
-Any::Base::~Base() {
+    reset();
 }
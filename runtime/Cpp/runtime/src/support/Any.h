@@ -4,6 +4,11 @@
  */
 
 // A standard C++ class loosely modeled after boost::Any.
+//
+// Values which fit into two pointers and can be moved without throwing (ints, doubles, pointers, small structs)
+// are stored inline, larger ones on the heap. The type of the value is identified by a pointer to a table of
+// functions which copy, move and destroy it, one per stored type, so is() and as() are a single pointer
+// comparison instead of a dynamic_cast.
 
 #pragma once
 
@@ -21,48 +26,59 @@ template<class T>
 
 struct ANTLR4CPP_PUBLIC Any
 {
-  bool isNull() const { return _ptr == nullptr; }
-  bool isNotNull() const { return _ptr != nullptr; }
+  bool isNull() const { return _operations == nullptr; }
+  bool isNotNull() const { return _operations != nullptr; }
 
-  Any() : _ptr(nullptr) {
+  Any() : _operations(nullptr) {
   }
 
-  Any(Any& that) : _ptr(that.clone()) {
+  Any(std::nullptr_t) : _operations(nullptr) {
   }
 
-  Any(Any&& that) : _ptr(that._ptr) {
-    that._ptr = nullptr;
+  Any(Any& that) : _operations(nullptr) {
+    copyFrom(that);
   }
 
-  Any(const Any& that) : _ptr(that.clone()) {
+  Any(Any&& that) : _operations(nullptr) {
+    moveFrom(that);
   }
 
-  Any(const Any&& that) : _ptr(that.clone()) {
+  Any(const Any& that) : _operations(nullptr) {
+    copyFrom(that);
+  }
+
+  Any(const Any&& that) : _operations(nullptr) {
+    copyFrom(that);
   }
 
   template<typename U>
-  Any(U&& value) : _ptr(new Derived<StorageType<U>>(std::forward<U>(value))) {
+  Any(U&& value) : _operations(&Handler<StorageType<U>>::operations) {
+    Handler<StorageType<U>>::create(_storage, std::forward<U>(value));
   }
 
   template<class U>
   bool is() const {
+    return _operations == &Handler<StorageType<U>>::operations;
+  }
+
+  template<class U>
+  StorageType<U>& as() {
     typedef StorageType<U> T;
 
-    auto derived = dynamic_cast<Derived<T> *>(_ptr);
+    if (!is<T>())
+      throw std::bad_cast();
 
-    return derived != nullptr;
+    return *Handler<T>::get(_storage);
   }
 
   template<class U>
-  StorageType<U>& as() {
+  const StorageType<U>& as() const {
     typedef StorageType<U> T;
 
-    auto derived = dynamic_cast<Derived<T>*>(_ptr);
-
-    if (!derived)
+    if (!is<T>())
       throw std::bad_cast();
 
-    return derived->value;
+    return *Handler<T>::get(const_cast<Storage &>(_storage));
   }
 
   template<class U>
@@ -71,69 +87,139 @@ struct ANTLR4CPP_PUBLIC Any
   }
 
   Any& operator = (const Any& a) {
-    if (_ptr == a._ptr)
+    if (this == &a)
       return *this;
 
-    auto old_ptr = _ptr;
-    _ptr = a.clone();
-
-    if (old_ptr)
-      delete old_ptr;
+    Any copy(a); // Copy first, so this stays unchanged if that throws.
+    reset();
+    moveFrom(copy);
 
     return *this;
   }
 
   Any& operator = (Any&& a) {
-    if (_ptr == a._ptr)
+    if (this == &a)
       return *this;
 
-    std::swap(_ptr, a._ptr);
+    reset();
+    moveFrom(a);
 
     return *this;
   }
 
   virtual ~Any();
 
+  // Values are not compared, only two null values are equal.
   virtual bool equals(Any other) const {
-    return _ptr == other._ptr;
+    return isNull() && other.isNull();
   }
 
 private:
-  struct Base {
-    virtual ~Base();
-    virtual Base* clone() const = 0;
+  union Storage {
+    void *pointer;
+    typename std::aligned_storage<2 * sizeof(void *)>::type buffer;
+  };
+
+  struct Operations {
+    void (*copy)(Storage &target, const Storage &source);
+    void (*move)(Storage &target, Storage &source); // Leaves nothing to destroy in source.
+    void (*destroy)(Storage &storage);
   };
 
+  template<typename T, bool Inline = sizeof(T) <= sizeof(Storage) && alignof(Storage) % alignof(T) == 0 &&
+    std::is_nothrow_move_constructible<T>::value>
+  struct Handler;
+
   template<typename T>
-  struct Derived : Base
-  {
-    template<typename U> Derived(U&& value_) : value(std::forward<U>(value_)) {
+  struct Handler<T, true> {
+    static const Operations operations;
+
+    template<typename U>
+    static void create(Storage &storage, U&& value) {
+      new (&storage.buffer) T(std::forward<U>(value));
     }
 
-    T value;
+    static T* get(Storage &storage) {
+      return reinterpret_cast<T *>(&storage.buffer);
+    }
+
+    static void copy(Storage &target, const Storage &source) {
+      new (&target.buffer) T(*reinterpret_cast<const T *>(&source.buffer));
+    }
 
-    Base* clone() const {
-      return new Derived<T>(value);
+    static void move(Storage &target, Storage &source) {
+      new (&target.buffer) T(std::move(*get(source)));
+      get(source)->~T();
     }
 
+    static void destroy(Storage &storage) {
+      get(storage)->~T();
+    }
   };
 
-  Base* clone() const
-  {
-    if (_ptr)
-      return _ptr->clone();
-    else
-      return nullptr;
+  template<typename T>
+  struct Handler<T, false> {
+    static const Operations operations;
+
+    template<typename U>
+    static void create(Storage &storage, U&& value) {
+      storage.pointer = new T(std::forward<U>(value));
+    }
+
+    static T* get(Storage &storage) {
+      return static_cast<T *>(storage.pointer);
+    }
+
+    static void copy(Storage &target, const Storage &source) {
+      target.pointer = new T(*static_cast<const T *>(source.pointer));
+    }
+
+    static void move(Storage &target, Storage &source) {
+      target.pointer = source.pointer;
+      source.pointer = nullptr;
+    }
+
+    static void destroy(Storage &storage) {
+      delete get(storage);
+    }
+  };
+
+  void copyFrom(const Any &that) {
+    if (that._operations != nullptr) {
+      that._operations->copy(_storage, that._storage);
+      _operations = that._operations;
+    }
   }
 
-  Base *_ptr;
+  void moveFrom(Any &that) {
+    if (that._operations != nullptr) {
+      that._operations->move(_storage, that._storage);
+      _operations = that._operations;
+      that._operations = nullptr;
+    }
+  }
+
+  void reset() {
+    if (_operations != nullptr) {
+      _operations->destroy(_storage);
+      _operations = nullptr;
+    }
+  }
+
+  const Operations *_operations; // Null for a null value, otherwise identifies the type.
+  Storage _storage;
 
 };
 
-  template<> inline
-  Any::Any(std::nullptr_t&& ) : _ptr(nullptr) {
-  }
+  template<typename T>
+  const Any::Operations Any::Handler<T, true>::operations = {
+    &Any::Handler<T, true>::copy, &Any::Handler<T, true>::move, &Any::Handler<T, true>::destroy
+  };
 
+  template<typename T>
+  const Any::Operations Any::Handler<T, false>::operations = {
+    &Any::Handler<T, false>::copy, &Any::Handler<T, false>::move, &Any::Handler<T, false>::destroy
+  };
 
 } // namespace antlrcpp
 
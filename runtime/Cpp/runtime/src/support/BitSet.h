@@ -7,15 +7,18 @@
 
 #include "antlr4-common.h"
 
-//#include <boost/dynamic_bitset.hpp>
-
-#include <vector>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
 
-namespace antlrcpp 
+namespace antlrcpp
 {
 
-/// Probably best would be to base this class on boost::dynamic_bitset.
-class ANTLR4CPP_PUBLIC BitSet final : protected std::vector<bool>
+/// A fixed capacity set of small non-negative integers (alternative numbers, rule indexes), stored as an array
+/// of 64 bit words. It needs no heap memory and all operations work a word at a time (popcount and count
+/// trailing zeros for cardinality and iteration). Only the words up to the highest one ever written to are
+/// touched, which for alternative sets is usually just the first.
+class ANTLR4CPP_PUBLIC BitSet final
   {
 public:
   enum
@@ -23,14 +26,22 @@ public:
     BIT_CAPACITY = 1024
     };
 
-  //using std::bitset<1024>::test;
-  //using std::bitset<1024>::operator!=;
-  //using std::bitset<1024>::operator|=;
+  BitSet() : _used(0)
+    {
+    std::fill(_words, _words + WORD_COUNT, Word(0));
+    }
 
   bool operator < (const BitSet& rhs) const
     {
-    std::less<std::vector<bool>> op;
-    return op(*this, rhs);
+    // Same order as a lexicographical compare of the bits, starting at index 0.
+    size_t used = std::max(_used, rhs._used);
+    for(size_t i = 0; i < used; ++i)
+      {
+      Word diff = _words[i] ^ rhs._words[i];
+      if(diff != 0)
+        return (rhs._words[i] & (diff & (~diff + 1))) != 0;
+      }
+    return false;
     }
 
   template <size_t S>
@@ -45,82 +56,71 @@ public:
 
   BitSet& operator|=(const BitSet& _Right)
     {
-    assert(size() < BIT_CAPACITY);
-    assert(_Right.size() < BIT_CAPACITY);
+    for(size_t i = 0; i < _Right._used; ++i)
+      _words[i] |= _Right._words[i];
 
-    if(_Right.size() > size())
-      resize(_Right.size());
+    _used = std::max(_used, _Right._used);
+    return *this;
+    }
 
-#ifdef _MSC_VER
-    for(size_t i = 0; i < this->_Myvec.size(); ++i)
-      {
-      auto& word = this->_Myvec[i];
-      const auto& word1 = _Right._Myvec[i];
-      word |= word1;
-      }
-#else
-   for(size_t i = 0; i < size(); ++i)
-     if(_Right[i])
-       (*this)[i] = true;
-#endif
+  BitSet& operator&=(const BitSet& _Right)
+    {
+    // Words beyond _Right._used are zero there, so ours can be cleared.
+    for(size_t i = 0; i < _used; ++i)
+      _words[i] &= _Right._words[i];
+
+    _used = std::min(_used, _Right._used);
     return *this;
     }
 
   bool test(size_t i) const
     {
-    assert(i < BIT_CAPACITY);
-    if(i < size())
-      return (*this)[i];
+    if(i >= BIT_CAPACITY)
+      return false;
 
-    return false;
+    return (_words[i / WORD_BITS] & bit(i)) != 0;
     }
 
   void setBit(size_t i)
     {
-    assert(i < BIT_CAPACITY);
-    if(size() <= i)
-      resize(i+1);
+    if(i >= BIT_CAPACITY)
+      throw std::out_of_range("BitSet index " + std::to_string(i) + " exceeds the capacity");
 
-    (*this)[i] = true;
+    size_t word = i / WORD_BITS;
+    _words[word] |= bit(i);
+    if(word >= _used)
+      _used = word + 1;
     }
 
   void clearBit(size_t i)
     {
-    assert(i < BIT_CAPACITY);
-    if(i < size())
-      (*this)[i] = false;
+    if(i < BIT_CAPACITY)
+      _words[i / WORD_BITS] &= ~bit(i);
     }
 
   size_t count() const
     {
-    unsigned int setBits = 0;
-
-#ifdef _MSC_VER
-    for(size_t i = 0; i < this->_Myvec.size(); ++i)
-      {
-      auto v = this->_Myvec[i];
-      unsigned int c; // c accumulates the total bits set in v
-      for(c = 0; v; c++)
-        v &= v - 1; // clear the least significant bit set
-
-      setBits += c;
-      }
-#else
-   for(const auto& b : *this)
-     if(b) ++setBits;
-#endif
+    size_t setBits = 0;
+    for(size_t i = 0; i < _used; ++i)
+      setBits += popCount(_words[i]);
 
     return setBits;
     }
 
   size_t bitCapacity() const
     {
-    return 1024; /// Limit taken from old std::bitset instantiation
+    return BIT_CAPACITY;
     }
 
   bool operator==(const BitSet& _Right) const
     {
-    return static_cast<const std::vector<bool>&>(*this) == _Right;
+    // Unused words are always zero, so comparing the longer range of the two covers everything.
+    size_t used = std::max(_used, _Right._used);
+    Word diff = 0;
+    for(size_t i = 0; i < used; ++i)
+      diff |= _words[i] ^ _Right._words[i];
+
+    return diff == 0;
     }
   bool operator!=(const BitSet& _Right) const
     {
@@ -129,14 +129,22 @@ public:
 
   size_t nextSetBit(size_t pos) const
   {
-    if(pos >= size())
+    size_t word = pos / WORD_BITS;
+    if(word >= _used)
       return INVALID_INDEX;
 
-    for(size_t i = pos; i < size(); i++)
-      if((*this)[i])
-        return i;
+    // Mask out the bits below pos in the first word.
+    Word current = _words[word] & (~Word(0) << (pos % WORD_BITS));
+    while(true)
+      {
+      if(current != 0)
+        return word * WORD_BITS + countTrailingZeros(current);
+
+      if(++word == _used)
+        return INVALID_INDEX;
 
-    return INVALID_INDEX;
+      current = _words[word];
+      }
   }
 
   // Prints a list of every index for which the bitset contains a bit in true.
@@ -177,26 +185,73 @@ public:
     return result;
     }
 
-  std::string toString()
+  std::string toString() const
     {
     std::stringstream stream;
     stream << "{";
     bool valueAdded = false;
-    for(size_t i = 0; i < size(); ++i)
+    for(size_t i = nextSetBit(0); i != INVALID_INDEX; i = nextSetBit(i + 1))
       {
-      if(test(i))
+      if(valueAdded)
         {
-        if(valueAdded)
-          {
-          stream << ", ";
-          }
-        stream << i;
-        valueAdded = true;
+        stream << ", ";
         }
+      stream << i;
+      valueAdded = true;
       }
 
     stream << "}";
     return stream.str();
     }
+
+private:
+  typedef uint64_t Word;
+
+  enum
+    {
+    WORD_BITS = 64,
+    WORD_COUNT = BIT_CAPACITY / WORD_BITS
+    };
+
+  static Word bit(size_t i)
+    {
+    return Word(1) << (i % WORD_BITS);
+    }
+
+  static size_t popCount(Word value)
+    {
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_popcountll(value));
+#else
+    // __popcnt64 would need a runtime CPU check, this compiles to a handful of instructions.
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<size_t>((value * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+  // value must not be 0.
+  static size_t countTrailingZeros(Word value)
+    {
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return index;
+#else
+    size_t result = 0;
+    while((value & 1) == 0)
+      {
+      value >>= 1;
+      ++result;
+      }
+    return result;
+#endif
+    }
+
+  Word _words[WORD_COUNT];
+  size_t _used; // Number of words which may contain set bits, all others are zero.
   };
 }
@@ -11,6 +11,7 @@ namespace antlr4 {
   class ANTLRFileStream;
   class ANTLRInputStream;
   class BailErrorStrategy;
+  class BatchParser;
   class BaseErrorListener;
   class BufferedTokenStream;
   class CharStream;
@@ -47,6 +48,7 @@ namespace antlr4 {
   class TokenSource;
   class TokenStream;
   class TokenStreamRewriter;
+  class UTF8CharStream;
   class UnbufferedCharStream;
   class UnbufferedTokenStream;
   class WritableToken;
@@ -76,9 +78,12 @@ namespace antlr4 {
     class BasicState;
     class BlockEndState;
     class BlockStartState;
+    class CompiledATN;
     class DecisionState;
     class EmptyPredictionContext;
     class EpsilonTransition;
+    class FollowSetCache;
+    class FullContextCache;
     class LL1Analyzer;
     class LexerAction;
     class LexerActionExecutor;
@@ -117,8 +122,10 @@ namespace antlr4 {
   namespace dfa {
     class DFA;
     class DFASerializer;
+    class DFASnapshot;
     class DFAState;
     class LexerDFASerializer;
+    class LexerDFATable;
     class Vocabulary;
   }
   namespace tree {
@@ -126,10 +133,12 @@ namespace antlr4 {
     class ErrorNode;
     class ErrorNodeImpl;
     class ParseTree;
+    enum class ParseTreeType;
     class ParseTreeListener;
     template<typename T> class ParseTreeProperty;
     class ParseTreeVisitor;
     class ParseTreeWalker;
+    class RuleDispatchTable;
     class SyntaxTree;
     class TerminalNode;
     class TerminalNodeImpl;
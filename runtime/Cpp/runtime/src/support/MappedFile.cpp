@@ -0,0 +1,112 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "Exceptions.h"
+#include "support/StringUtils.h"
+
+#include "support/MappedFile.h"
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+using namespace antlr4;
+using namespace antlrcpp;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string &fileName, bool /*sequential*/)
+  : _view(nullptr), _viewSize(0), _mapping(nullptr) {
+  HANDLE file = CreateFileW(antlrcpp::s2ws(fileName).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw IOException("Cannot open file " + fileName);
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    throw IOException("Cannot determine the size of " + fileName);
+  }
+
+  // Empty files cannot be mapped.
+  if (size.QuadPart > 0) {
+    _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping != nullptr) {
+      _view = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+  }
+  CloseHandle(file); // The mapping keeps its own reference to the file.
+
+  if (size.QuadPart > 0 && _view == nullptr) {
+    unmap();
+    throw IOException("Cannot map file " + fileName);
+  }
+
+  _viewSize = static_cast<size_t>(size.QuadPart);
+}
+
+void MappedFile::unmap() {
+  if (_view != nullptr) {
+    UnmapViewOfFile(_view);
+    _view = nullptr;
+  }
+  if (_mapping != nullptr) {
+    CloseHandle(_mapping);
+    _mapping = nullptr;
+  }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &fileName, bool sequential) : _view(nullptr), _viewSize(0) {
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw IOException("Cannot open file " + fileName);
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    throw IOException("Cannot determine the size of " + fileName);
+  }
+
+  // Empty files cannot be mapped.
+  if (info.st_size > 0) {
+    _viewSize = static_cast<size_t>(info.st_size);
+    void *view = mmap(nullptr, _viewSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED) {
+      close(fd);
+      throw IOException("Cannot map file " + fileName);
+    }
+    _view = view;
+
+    if (sequential) {
+      madvise(_view, _viewSize, MADV_SEQUENTIAL);
+    }
+  }
+  close(fd); // The mapping stays valid after closing the descriptor.
+}
+
+void MappedFile::unmap() {
+  if (_view != nullptr) {
+    munmap(_view, _viewSize);
+    _view = nullptr;
+  }
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+  unmap();
+}
@@ -0,0 +1,42 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlrcpp {
+
+  /// A read-only memory mapping of a whole file. The file must not be modified while it is mapped.
+  class ANTLR4CPP_PUBLIC MappedFile {
+  public:
+    /// Assumes a file name encoded in UTF-8. Set sequential if the content is read front to back, which
+    /// lets the OS read ahead more aggressively. Throws an antlr4::IOException if the file cannot be
+    /// opened or mapped. Empty files give an empty mapping (with a null data pointer).
+    MappedFile(const std::string &fileName, bool sequential = false);
+    MappedFile(const MappedFile &other) = delete;
+    ~MappedFile();
+
+    MappedFile& operator = (const MappedFile &other) = delete;
+
+    const char* data() const {
+      return static_cast<const char *>(_view);
+    }
+
+    size_t size() const {
+      return _viewSize;
+    }
+
+  private:
+    void *_view;
+    size_t _viewSize;
+#ifdef _WIN32
+    void *_mapping;
+#endif
+
+    void unmap();
+  };
+
+} // namespace antlrcpp
@@ -0,0 +1,101 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "support/PoolAllocator.h"
+
+using namespace antlrcpp;
+
+namespace {
+
+  const size_t GRANULARITY = 16;
+  const size_t SIZE_CLASSES = ObjectPool::MAX_BLOCK_SIZE / GRANULARITY;
+
+  // Upper bound for the number of blocks a thread keeps per size class, so that a burst of allocations
+  // (e.g. a huge full context prediction) doesn't pin that memory forever.
+  const size_t MAX_CACHED_BLOCKS = 16 * 1024;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct FreeList {
+    FreeBlock *head = nullptr;
+    size_t count = 0;
+  };
+
+  // Set once the cache of the current thread has been destroyed. Objects can still be released after that
+  // (e.g. static DFAs at process exit), they then go straight back to the global heap.
+  thread_local bool cacheDestroyed = false;
+
+  struct ThreadCache {
+    FreeList lists[SIZE_CLASSES];
+
+    ~ThreadCache() {
+      ObjectPool::trim();
+      cacheDestroyed = true;
+    }
+  };
+
+  thread_local ThreadCache cache;
+
+  inline size_t sizeClass(size_t size) {
+    return (size + GRANULARITY - 1) / GRANULARITY - 1;
+  }
+
+}
+
+void* ObjectPool::allocate(size_t size) {
+  if (size == 0 || size > MAX_BLOCK_SIZE || cacheDestroyed) {
+    return ::operator new(size);
+  }
+
+  size_t index = sizeClass(size);
+  FreeList &list = cache.lists[index];
+  if (list.head == nullptr) {
+    return ::operator new((index + 1) * GRANULARITY);
+  }
+
+  FreeBlock *block = list.head;
+  list.head = block->next;
+  --list.count;
+  return block;
+}
+
+void ObjectPool::deallocate(void *block, size_t size) NOEXCEPT {
+  if (block == nullptr) {
+    return;
+  }
+
+  if (size == 0 || size > MAX_BLOCK_SIZE || cacheDestroyed) {
+    ::operator delete(block);
+    return;
+  }
+
+  FreeList &list = cache.lists[sizeClass(size)];
+  if (list.count >= MAX_CACHED_BLOCKS) {
+    ::operator delete(block);
+    return;
+  }
+
+  FreeBlock *freeBlock = static_cast<FreeBlock *>(block);
+  freeBlock->next = list.head;
+  list.head = freeBlock;
+  ++list.count;
+}
+
+void ObjectPool::trim() NOEXCEPT {
+  if (cacheDestroyed) {
+    return;
+  }
+
+  for (FreeList &list : cache.lists) {
+    while (list.head != nullptr) {
+      FreeBlock *next = list.head->next;
+      ::operator delete(list.head);
+      list.head = next;
+    }
+    list.count = 0;
+  }
+}
@@ -0,0 +1,64 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlrcpp {
+
+  /// Thread local free lists for the small objects the ATN simulators create by the thousands during
+  /// closure (configurations and prediction contexts, including their shared_ptr control blocks).
+  /// Freed blocks go to a free list of the releasing thread, sorted by size class, and are handed out
+  /// again by the next allocation of the same size class. In steady state prediction therefore doesn't
+  /// call into the global heap at all. Blocks larger than MAX_BLOCK_SIZE use operator new directly.
+  class ANTLR4CPP_PUBLIC ObjectPool {
+  public:
+    static const size_t MAX_BLOCK_SIZE = 256;
+
+    static void* allocate(size_t size);
+    static void deallocate(void *block, size_t size) NOEXCEPT;
+
+    /// Returns all cached blocks of the calling thread to the global heap.
+    static void trim() NOEXCEPT;
+  };
+
+  /// A stateless allocator using the ObjectPool, meant for std::allocate_shared.
+  template <typename T>
+  class PoolAllocator {
+  public:
+    typedef T value_type;
+
+    PoolAllocator() NOEXCEPT {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &) NOEXCEPT {}
+
+    T* allocate(size_t n) {
+      return static_cast<T *>(ObjectPool::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n) NOEXCEPT {
+      ObjectPool::deallocate(p, n * sizeof(T));
+    }
+  };
+
+  template <typename T, typename U>
+  inline bool operator == (const PoolAllocator<T> &, const PoolAllocator<U> &) {
+    return true;
+  }
+
+  template <typename T, typename U>
+  inline bool operator != (const PoolAllocator<T> &, const PoolAllocator<U> &) {
+    return false;
+  }
+
+  /// Like std::make_shared, but places the object (and its reference count) into the ObjectPool.
+  template <typename T, typename... Args>
+  inline std::shared_ptr<T> makePooled(Args&&... args) {
+    return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+  }
+
+} // namespace antlrcpp
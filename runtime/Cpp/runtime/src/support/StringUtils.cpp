@@ -5,6 +5,8 @@
 
 #include "support/StringUtils.h"
 
+#include <stdexcept>
+
 namespace antlrcpp {
 
 void replaceAll(std::string& str, std::string const& from, std::string const& to)
@@ -19,6 +21,22 @@ void replaceAll(std::string& str, std::string const& from, std::string const& to
   }
 }
 
+std::string utf32_to_utf8(const UTF32Char *first, const UTF32Char *last) {
+  std::string result;
+  if (!Utf8::encode(first, last, result))
+    throw std::range_error("bad conversion");
+
+  return result;
+}
+
+UTF32String utf8_to_utf32(const char* first, const char* last) {
+  UTF32String result;
+  if (!Utf8::decode(first, last, result))
+    throw std::range_error("bad conversion");
+
+  return result;
+}
+
 std::string ws2s(std::wstring const& wstr) {
   std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
   std::string narrow = converter.to_bytes(wstr);
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "antlr4-common.h"
+#include "support/Utf8.h"
 
 namespace antlrcpp {
 
@@ -17,34 +18,17 @@ namespace antlrcpp {
   typedef std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> UTF32Converter;
 #endif
   
-  // The conversion functions fails in VS2017, so we explicitly use a workaround.
+  // Both conversions use the vectorized transcoder in Utf8.h and throw std::range_error on invalid input
+  // (as std::wstring_convert did before).
+  ANTLR4CPP_PUBLIC std::string utf32_to_utf8(const UTF32Char *first, const UTF32Char *last);
+
   template<typename T>
   inline std::string utf32_to_utf8(T const& data)
   {
-    // Don't make the converter static or we have to serialize access to it.
-    UTF32Converter converter;
-
-    #if defined(_MSC_VER) && _MSC_VER >= 1900 && _MSC_VER < 2000
-      auto p = reinterpret_cast<const int32_t *>(data.data());
-      return converter.to_bytes(p, p + data.size());
-    #else
-      return converter.to_bytes(data);
-    #endif
+    return utf32_to_utf8(data.data(), data.data() + data.size());
   }
 
-  inline UTF32String utf8_to_utf32(const char* first, const char* last)
-  {
-    UTF32Converter converter;
-
-    #if defined(_MSC_VER) && _MSC_VER >= 1900 && _MSC_VER < 2000
-      auto r = converter.from_bytes(first, last);
-      i32string s = reinterpret_cast<const int32_t *>(r.data());
-    #else
-      std::u32string s = converter.from_bytes(first, last);
-    #endif
-    
-    return s;
-  }
+  ANTLR4CPP_PUBLIC UTF32String utf8_to_utf32(const char* first, const char* last);
 
   void replaceAll(std::string &str, std::string const& from, std::string const& to);
 
@@ -0,0 +1,414 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "support/Utf8.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define ANTLR4CPP_SSE2
+  #include <emmintrin.h>
+
+  // AVX2 code is compiled with per function target attributes (GCC, clang) or as is (VS), so the library
+  // itself doesn't require an AVX2 capable machine.
+  #if defined(_MSC_VER) && _MSC_VER >= 1900
+    #define ANTLR4CPP_AVX2
+    #define ANTLR4CPP_AVX2_TARGET
+    #include <immintrin.h>
+    #include <intrin.h>
+  #elif (defined(__GNUC__) && __GNUC__ >= 5) || defined(__clang__)
+    #define ANTLR4CPP_AVX2
+    #define ANTLR4CPP_AVX2_TARGET __attribute__((target("avx2")))
+    #include <immintrin.h>
+  #endif
+#endif
+
+using namespace antlrcpp;
+
+namespace {
+
+  static_assert(sizeof(UTF32Char) == 4, "UTF-32 code units must be 4 bytes wide");
+
+  // A kernel processes the ASCII run at the start of a buffer in whole blocks and returns the number
+  // of bytes it handled. It stops at the first block containing a non ASCII byte; the rest is left
+  // to the scalar code. widen() also stores the code points, skip() only checks the bytes.
+  struct Kernel {
+    size_t (*widen)(const unsigned char *input, size_t length, UTF32Char *output);
+    size_t (*skip)(const unsigned char *input, size_t length);
+    size_t (*narrow)(const UTF32Char *input, size_t length, unsigned char *output);
+  };
+
+  const uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+  size_t widenScalar(const unsigned char *input, size_t length, UTF32Char *output) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      uint64_t block;
+      std::memcpy(&block, input + i, 8);
+      if ((block & HIGH_BITS) != 0) {
+        break;
+      }
+      for (size_t j = 0; j < 8; ++j) {
+        output[i + j] = input[i + j];
+      }
+    }
+    return i;
+  }
+
+  size_t skipScalar(const unsigned char *input, size_t length) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      uint64_t block;
+      std::memcpy(&block, input + i, 8);
+      if ((block & HIGH_BITS) != 0) {
+        break;
+      }
+    }
+    return i;
+  }
+
+  size_t narrowScalar(const UTF32Char *input, size_t length, unsigned char *output) {
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+      if ((static_cast<uint32_t>(input[i]) | static_cast<uint32_t>(input[i + 1]) | static_cast<uint32_t>(input[i + 2]) |
+        static_cast<uint32_t>(input[i + 3])) >= 0x80) {
+        break;
+      }
+      for (size_t j = 0; j < 4; ++j) {
+        output[i + j] = static_cast<unsigned char>(input[i + j]);
+      }
+    }
+    return i;
+  }
+
+#ifdef ANTLR4CPP_SSE2
+
+  size_t widenSSE2(const unsigned char *input, size_t length, UTF32Char *output) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+      if (_mm_movemask_epi8(bytes) != 0) {
+        break;
+      }
+      __m128i low = _mm_unpacklo_epi8(bytes, zero);
+      __m128i high = _mm_unpackhi_epi8(bytes, zero);
+      __m128i *target = reinterpret_cast<__m128i *>(output + i);
+      _mm_storeu_si128(target, _mm_unpacklo_epi16(low, zero));
+      _mm_storeu_si128(target + 1, _mm_unpackhi_epi16(low, zero));
+      _mm_storeu_si128(target + 2, _mm_unpacklo_epi16(high, zero));
+      _mm_storeu_si128(target + 3, _mm_unpackhi_epi16(high, zero));
+    }
+    return i;
+  }
+
+  size_t skipSSE2(const unsigned char *input, size_t length) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+      __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+      __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i + 16));
+      if (_mm_movemask_epi8(_mm_or_si128(first, second)) != 0) {
+        break;
+      }
+    }
+    return i;
+  }
+
+  size_t narrowSSE2(const UTF32Char *input, size_t length, unsigned char *output) {
+    const __m128i nonAscii = _mm_set1_epi32(~0x7F);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+      const __m128i *source = reinterpret_cast<const __m128i *>(input + i);
+      __m128i a = _mm_loadu_si128(source);
+      __m128i b = _mm_loadu_si128(source + 1);
+      __m128i c = _mm_loadu_si128(source + 2);
+      __m128i d = _mm_loadu_si128(source + 3);
+      __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonAscii);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF) {
+        break;
+      }
+      __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), bytes);
+    }
+    return i;
+  }
+
+#endif
+
+#ifdef ANTLR4CPP_AVX2
+
+  ANTLR4CPP_AVX2_TARGET
+  size_t widenAVX2(const unsigned char *input, size_t length, UTF32Char *output) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+      __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+      if (_mm256_movemask_epi8(bytes) != 0) {
+        break;
+      }
+      __m128i low = _mm256_castsi256_si128(bytes);
+      __m128i high = _mm256_extracti128_si256(bytes, 1);
+      __m256i *target = reinterpret_cast<__m256i *>(output + i);
+      _mm256_storeu_si256(target, _mm256_cvtepu8_epi32(low));
+      _mm256_storeu_si256(target + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+      _mm256_storeu_si256(target + 2, _mm256_cvtepu8_epi32(high));
+      _mm256_storeu_si256(target + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+    }
+    return i;
+  }
+
+  ANTLR4CPP_AVX2_TARGET
+  size_t skipAVX2(const unsigned char *input, size_t length) {
+    size_t i = 0;
+    for (; i + 64 <= length; i += 64) {
+      __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+      __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i + 32));
+      if (_mm256_movemask_epi8(_mm256_or_si256(first, second)) != 0) {
+        break;
+      }
+    }
+    return i;
+  }
+
+  bool cpuHasAVX2() {
+  #ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+      return false;
+    }
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) { // The OS must save the YMM registers.
+      return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+  #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  #endif
+  }
+
+#endif
+
+  const Kernel kernels[] = {
+    { widenScalar, skipScalar, narrowScalar },
+#ifdef ANTLR4CPP_SSE2
+    { widenSSE2, skipSSE2, narrowSSE2 },
+#else
+    { widenScalar, skipScalar, narrowScalar },
+#endif
+#ifdef ANTLR4CPP_AVX2
+    { widenAVX2, skipAVX2, narrowSSE2 },
+#else
+    { widenScalar, skipScalar, narrowScalar },
+#endif
+  };
+
+  Utf8::Isa detectIsa() {
+#if defined(ANTLR4CPP_AVX2)
+    return cpuHasAVX2() ? Utf8::Isa::AVX2 : Utf8::Isa::SSE2;
+#elif defined(ANTLR4CPP_SSE2)
+    return Utf8::Isa::SSE2;
+#else
+    return Utf8::Isa::Scalar;
+#endif
+  }
+
+  const Kernel& kernelFor(Utf8::Isa isa) {
+    if (isa > Utf8::bestIsa()) {
+      isa = Utf8::bestIsa();
+    }
+    return kernels[static_cast<size_t>(isa)];
+  }
+
+  /// Decodes the multi byte sequence at input (the lead byte is >= 0x80), following table 3-7 of the
+  /// Unicode standard. Returns the length of the sequence or 0 if it is malformed.
+  inline size_t decodeSequence(const unsigned char *input, const unsigned char *end, uint32_t &codePoint) {
+    unsigned char lead = input[0];
+    size_t available = static_cast<size_t>(end - input);
+
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      if (available < 2 || (input[1] & 0xC0) != 0x80) {
+        return 0;
+      }
+      codePoint = ((lead & 0x1Fu) << 6) | (input[1] & 0x3Fu);
+      return 2;
+    }
+
+    if (lead >= 0xE0 && lead <= 0xEF) {
+      if (available < 3) {
+        return 0;
+      }
+      unsigned char lower = lead == 0xE0 ? 0xA0 : 0x80;
+      unsigned char upper = lead == 0xED ? 0x9F : 0xBF;
+      if (input[1] < lower || input[1] > upper || (input[2] & 0xC0) != 0x80) {
+        return 0;
+      }
+      codePoint = ((lead & 0x0Fu) << 12) | ((input[1] & 0x3Fu) << 6) | (input[2] & 0x3Fu);
+      return 3;
+    }
+
+    if (lead >= 0xF0 && lead <= 0xF4) {
+      if (available < 4) {
+        return 0;
+      }
+      unsigned char lower = lead == 0xF0 ? 0x90 : 0x80;
+      unsigned char upper = lead == 0xF4 ? 0x8F : 0xBF;
+      if (input[1] < lower || input[1] > upper || (input[2] & 0xC0) != 0x80 || (input[3] & 0xC0) != 0x80) {
+        return 0;
+      }
+      codePoint = ((lead & 0x07u) << 18) | ((input[1] & 0x3Fu) << 12) | ((input[2] & 0x3Fu) << 6) | (input[3] & 0x3Fu);
+      return 4;
+    }
+
+    return 0; // Continuation byte, overlong 2 byte form (C0, C1) or beyond U+10FFFF (F5..FF).
+  }
+
+}
+
+Utf8::Isa Utf8::bestIsa() {
+  static const Isa isa = detectIsa();
+  return isa;
+}
+
+std::string Utf8::isaName(Isa isa) {
+  switch (isa) {
+    case Isa::Scalar:
+      return "scalar";
+    case Isa::SSE2:
+      return "SSE2";
+    case Isa::AVX2:
+      return "AVX2";
+  }
+  return "";
+}
+
+bool Utf8::validate(const char *first, const char *last, Isa isa) {
+  const Kernel &kernel = kernelFor(isa);
+  const unsigned char *input = reinterpret_cast<const unsigned char *>(first);
+  const unsigned char *end = reinterpret_cast<const unsigned char *>(last);
+
+  while (input < end) {
+    input += kernel.skip(input, static_cast<size_t>(end - input));
+
+    // Scalar part: up to the next block boundary worth handing back to the kernel.
+    while (input < end && *input < 0x80) {
+      ++input;
+      if ((reinterpret_cast<uintptr_t>(input) & 0x0F) == 0) {
+        break;
+      }
+    }
+
+    if (input < end && *input >= 0x80) {
+      uint32_t codePoint;
+      size_t length = decodeSequence(input, end, codePoint);
+      if (length == 0) {
+        return false;
+      }
+      input += length;
+    }
+  }
+  return true;
+}
+
+bool Utf8::decode(const char *first, const char *last, UTF32String &result, Isa isa) {
+  const Kernel &kernel = kernelFor(isa);
+  const unsigned char *input = reinterpret_cast<const unsigned char *>(first);
+  const unsigned char *end = reinterpret_cast<const unsigned char *>(last);
+
+  // There can't be more code points than bytes.
+  size_t start = result.size();
+  result.resize(start + static_cast<size_t>(end - input));
+  UTF32Char *output = &result[0] + start;
+  UTF32Char *outputStart = output;
+
+  while (input < end) {
+    size_t count = kernel.widen(input, static_cast<size_t>(end - input), output);
+    input += count;
+    output += count;
+
+    while (input < end && *input < 0x80) {
+      *output++ = *input++;
+      if ((reinterpret_cast<uintptr_t>(input) & 0x0F) == 0) {
+        break;
+      }
+    }
+
+    if (input < end && *input >= 0x80) {
+      uint32_t codePoint;
+      size_t length = decodeSequence(input, end, codePoint);
+      if (length == 0) {
+        result.resize(start);
+        return false;
+      }
+      *output++ = static_cast<UTF32Char>(codePoint);
+      input += length;
+    }
+  }
+
+  result.resize(start + static_cast<size_t>(output - outputStart));
+  return true;
+}
+
+bool Utf8::encode(const UTF32Char *first, const UTF32Char *last, std::string &result, Isa isa) {
+  const Kernel &kernel = kernelFor(isa);
+
+  // Size for the all ASCII case, that's what we optimize for (plus room for one multi byte form).
+  // Longer forms grow the string as needed.
+  size_t start = result.size();
+  size_t capacity = start + static_cast<size_t>(last - first) + 4;
+  result.resize(capacity);
+  size_t position = start;
+
+  while (first < last) {
+    if (capacity - position < static_cast<size_t>(last - first) + 4) {
+      capacity = position + static_cast<size_t>(last - first) + 4 + (capacity - start) / 2;
+      result.resize(capacity);
+    }
+
+    unsigned char *output = reinterpret_cast<unsigned char *>(&result[0]) + position;
+    size_t count = kernel.narrow(first, static_cast<size_t>(last - first), output);
+    first += count;
+    position += count;
+
+    // Handle the remaining code points one by one, until the next ASCII block or until we run out of space.
+    while (first < last && capacity - position >= 4) {
+      uint32_t codePoint = static_cast<uint32_t>(*first);
+      if (codePoint < 0x80) {
+        result[position++] = static_cast<char>(codePoint);
+        if ((reinterpret_cast<uintptr_t>(++first) & 0x3F) == 0) {
+          break;
+        }
+        continue;
+      }
+
+      if (codePoint < 0x800) {
+        result[position++] = static_cast<char>(0xC0 | (codePoint >> 6));
+      } else if (codePoint < 0x10000) {
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+          result.resize(start);
+          return false;
+        }
+        result[position++] = static_cast<char>(0xE0 | (codePoint >> 12));
+        result[position++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      } else if (codePoint <= 0x10FFFF) {
+        result[position++] = static_cast<char>(0xF0 | (codePoint >> 18));
+        result[position++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        result[position++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      } else {
+        result.resize(start);
+        return false;
+      }
+      result[position++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+      ++first;
+    }
+  }
+
+  result.resize(position);
+  return true;
+}
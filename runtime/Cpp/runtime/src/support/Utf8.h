@@ -0,0 +1,44 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlrcpp {
+
+  typedef UTF32String::value_type UTF32Char;
+
+  /// UTF-8 <-> UTF-32 transcoding and UTF-8 validation.
+  ///
+  /// Runs of ASCII are processed a whole vector register at a time (SSE2 or AVX2, whatever the CPU
+  /// supports, detected at runtime), everything else goes through a strict scalar decoder. Malformed input
+  /// (invalid or truncated sequences, overlong forms, surrogates, values beyond U+10FFFF) is rejected.
+  class ANTLR4CPP_PUBLIC Utf8 {
+  public:
+    enum class Isa {
+      Scalar,
+      SSE2,
+      AVX2
+    };
+
+    /// The best instruction set available on this machine.
+    static Isa bestIsa();
+    static std::string isaName(Isa isa);
+
+    /// The isa parameter exists mostly for testing and benchmarking. Instruction sets which are not
+    /// supported by the CPU are replaced by the best one available.
+    static bool validate(const char *first, const char *last, Isa isa = bestIsa());
+
+    /// Appends the code points in [first, last) to result. Returns false on malformed input,
+    /// in which case result is left unchanged.
+    static bool decode(const char *first, const char *last, UTF32String &result, Isa isa = bestIsa());
+
+    /// Appends the UTF-8 form of [first, last) to result. Returns false if a value is not
+    /// a valid code point, in which case result is left unchanged.
+    static bool encode(const UTF32Char *first, const UTF32Char *last, std::string &result, Isa isa = bestIsa());
+  };
+
+} // namespace antlrcpp
@@ -5,5 +5,10 @@
 
 #include "tree/ErrorNode.h"
 
+antlr4::tree::ErrorNode::ErrorNode() {
+  // TerminalNode is a virtual base and hence already constructed here.
+  _treeType = ParseTreeType::ERROR_NODE;
+}
+
 antlr4::tree::ErrorNode::~ErrorNode() {
 }
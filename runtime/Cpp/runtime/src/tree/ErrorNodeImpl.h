@@ -29,5 +29,9 @@ namespace tree {
     virtual antlrcpp::Any accept(ParseTreeVisitor *visitor) override;
   };
 
+  template<>
+  struct IsTriviallyReleasable<ErrorNodeImpl> : std::true_type {
+  };
+
 } // namespace tree
 } // namespace antlr4
@@ -14,58 +14,48 @@
 using namespace antlr4::tree;
 
 void IterativeParseTreeWalker::walk(ParseTreeListener *listener, ParseTree *t) const {
-
-  std::vector<ParseTree *> nodeStack;
-  std::vector<size_t> indexStack;
+  // The open nodes, each with the index of the child currently walked.
+  std::vector<std::pair<ParseTree *, size_t>> stack;
+  stack.reserve(64);
 
   ParseTree *currentNode = t;
-  size_t currentIndex = 0;
-
   while (currentNode != nullptr) {
     // pre-order visit
-    if (antlrcpp::is<ErrorNode *>(currentNode)) {
-      listener->visitErrorNode(dynamic_cast<ErrorNode *>(currentNode));
-    } else if (antlrcpp::is<TerminalNode *>(currentNode)) {
-      listener->visitTerminal((TerminalNode *)currentNode);
-    } else {
-      enterRule(listener, currentNode);
-    }
+    switch (currentNode->getTreeType()) {
+      case ParseTreeType::ERROR_NODE:
+        listener->visitErrorNode(dynamic_cast<ErrorNode *>(currentNode));
+        break;
 
-    // Move down to first child, if it exists.
-    if (!currentNode->children.empty()) {
-      nodeStack.push_back(currentNode);
-      indexStack.push_back(currentIndex);
-      currentIndex = 0;
-      currentNode = currentNode->children[0];
-      continue;
-    }
+      case ParseTreeType::TERMINAL:
+        listener->visitTerminal(static_cast<TerminalNode *>(currentNode));
+        break;
 
-    // No child nodes, so walk tree.
-    do {
-      // post-order visit
-      if (!antlrcpp::is<TerminalNode *>(currentNode)) {
-        exitRule(listener, currentNode);
-      }
+      case ParseTreeType::RULE:
+        enterRule(listener, currentNode);
+
+        // Move down to first child, if it exists.
+        if (!currentNode->children.empty()) {
+          stack.push_back({ currentNode, 0 });
+          currentNode = currentNode->children[0];
+          continue;
+        }
 
-      // No parent, so no siblings.
-      if (nodeStack.empty()) {
-        currentNode = nullptr;
-        currentIndex = 0;
+        exitRule(listener, currentNode);
         break;
-      }
+    }
 
-      // Move to next sibling if possible.
-      if (nodeStack.back()->children.size() > ++currentIndex) {
-        currentNode = nodeStack.back()->children[currentIndex];
+    // No (more) child nodes, so move to the next sibling if possible, otherwise up.
+    currentNode = nullptr;
+    while (!stack.empty()) {
+      std::pair<ParseTree *, size_t> &top = stack.back();
+      if (++top.second < top.first->children.size()) {
+        currentNode = top.first->children[top.second];
         break;
       }
 
-      // No next sibling, so move up.
-      currentNode = nodeStack.back();
-      nodeStack.pop_back();
-      currentIndex = indexStack.back();
-      indexStack.pop_back();
-
-    } while (currentNode != nullptr);
+      // post-order visit
+      exitRule(listener, top.first);
+      stack.pop_back();
+    }
   }
 }
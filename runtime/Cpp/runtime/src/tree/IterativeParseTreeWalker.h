@@ -46,6 +46,8 @@ namespace tree {
    */
   class ANTLR4CPP_PUBLIC IterativeParseTreeWalker : public ParseTreeWalker {
   public:
+    using ParseTreeWalker::walk;
+
     virtual void walk(ParseTreeListener *listener, ParseTree *t) const override;
   };
 
@@ -3,11 +3,242 @@
  * can be found in the LICENSE.txt file in the project root.
  */
 
+#include "Exceptions.h"
+
 #include "tree/ParseTree.h"
 
 using namespace antlr4::tree;
 
-ParseTree::ParseTree() : parent(nullptr) {
+namespace {
+
+  const size_t ALIGNMENT = 16;
+
+  inline size_t alignUp(size_t size) {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  }
+
+}
+
+//------------------ ParseTreeChildren ---------------------------------------------------------------------------------
+
+ParseTreeChildren::ParseTreeChildren() : _data(nullptr), _size(0), _capacity(0), _tracker(nullptr) {
+}
+
+ParseTreeChildren::ParseTreeChildren(std::initializer_list<ParseTree *> list) : ParseTreeChildren() {
+  assign(list.begin(), list.end());
+}
+
+ParseTreeChildren::ParseTreeChildren(const ParseTreeChildren &other) : ParseTreeChildren() {
+  assign(other.begin(), other.end());
+}
+
+ParseTreeChildren::~ParseTreeChildren() {
+  if (_tracker == nullptr) {
+    delete[] _data;
+  }
+}
+
+ParseTreeChildren& ParseTreeChildren::operator = (const ParseTreeChildren &other) {
+  if (this != &other) {
+    assign(other.begin(), other.end());
+  }
+  return *this;
+}
+
+ParseTreeChildren& ParseTreeChildren::operator = (std::initializer_list<ParseTree *> list) {
+  assign(list.begin(), list.end());
+  return *this;
+}
+
+ParseTreeChildren::iterator ParseTreeChildren::erase(const_iterator position) {
+  return erase(position, position + 1);
+}
+
+ParseTreeChildren::iterator ParseTreeChildren::erase(const_iterator first, const_iterator last) {
+  iterator target = _data + (first - _data);
+  iterator rest = std::copy(last, const_cast<const_iterator>(end()), target);
+  _size = static_cast<size_t>(rest - _data);
+  return target;
+}
+
+void ParseTreeChildren::reserve(size_t capacity) {
+  if (capacity > _capacity) {
+    setStorage(capacity);
+  }
+}
+
+void ParseTreeChildren::shrink_to_fit() {
+  // Arena memory cannot be given back individually, so only heap storage is trimmed. An empty list lets go
+  // of its arena storage though, which matters when that is about to be rewound.
+  if (_tracker == nullptr) {
+    if (_size < _capacity) {
+      setStorage(_size);
+    }
+  } else if (_size == 0) {
+    _data = nullptr;
+    _capacity = 0;
+  }
+}
+
+void ParseTreeChildren::attach(ParseTreeTracker *tracker) {
+  if (_tracker == tracker) {
+    return;
+  }
+
+  ParseTree **old = _data;
+  bool ownedOld = _tracker == nullptr;
+  _tracker = tracker;
+  _data = nullptr;
+  if (_capacity > 0) {
+    _data = static_cast<ParseTree **>(_tracker->allocate(_capacity * sizeof(ParseTree *)));
+    std::copy(old, old + _size, _data);
+  }
+  if (ownedOld) {
+    delete[] old;
+  }
+}
+
+void ParseTreeChildren::grow(size_t minimum) {
+  setStorage(std::max(minimum, _capacity == 0 ? size_t(2) : 2 * _capacity));
+}
+
+void ParseTreeChildren::assign(const_iterator first, const_iterator last) {
+  size_t count = static_cast<size_t>(last - first);
+  if (count > _capacity) {
+    _size = 0; // Nothing to keep.
+    setStorage(count);
+  }
+  std::copy(first, last, _data);
+  _size = count;
+}
+
+void ParseTreeChildren::setStorage(size_t capacity) {
+  ParseTree **data = nullptr;
+  if (capacity > 0) {
+    if (_tracker != nullptr) {
+      data = static_cast<ParseTree **>(_tracker->allocate(capacity * sizeof(ParseTree *)));
+    } else {
+      data = new ParseTree *[capacity]; /* mem-check: deleted in destructor or on the next resize */
+    }
+    std::copy(_data, _data + _size, data);
+  }
+
+  if (_tracker == nullptr) {
+    delete[] _data;
+  }
+  _data = data;
+  _capacity = capacity;
+}
+
+//------------------ ParseTreeTracker ----------------------------------------------------------------------------------
+
+ParseTreeTracker::ParseTreeTracker() : _blocks(nullptr), _cursor(nullptr), _limit(nullptr) {
+}
+
+ParseTreeTracker::~ParseTreeTracker() {
+  reset();
+  if (_blocks != nullptr) {
+    ::operator delete(_blocks);
+  }
+}
+
+void* ParseTreeTracker::allocate(size_t size) {
+  size = alignUp(size);
+  if (static_cast<size_t>(_limit - _cursor) < size) {
+    // Oversized requests get a block of their own. Blocks are kept in a list with the first block last,
+    // which is the one reset() keeps for the next parse run.
+    size_t capacity = std::max(BLOCK_SIZE, size);
+    void *memory = ::operator new(alignUp(sizeof(Block)) + capacity); /* mem-check: freed in reset() or destructor */
+    Block *block = new (memory) Block();
+    block->next = _blocks;
+    block->size = capacity;
+    _blocks = block;
+    _cursor = static_cast<char *>(memory) + alignUp(sizeof(Block));
+    _limit = _cursor + capacity;
+  }
+
+  void *result = _cursor;
+  _cursor += size;
+  return result;
+}
+
+void ParseTreeTracker::reset() {
+  // In creation order, so parents go before their children (just like it was when each node was deleted).
+  for (auto entry : _destructible) {
+    entry->~ParseTree();
+  }
+  _destructible.clear();
+
+  if (_blocks == nullptr) {
+    return;
+  }
+
+  while (_blocks->next != nullptr) {
+    Block *next = _blocks->next;
+    ::operator delete(_blocks);
+    _blocks = next;
+  }
+  _cursor = reinterpret_cast<char *>(_blocks) + alignUp(sizeof(Block));
+  _limit = _cursor + _blocks->size;
+}
+
+ParseTreeTracker::Mark ParseTreeTracker::mark() const {
+  Mark mark = { _blocks, _cursor, _destructible.size() };
+  return mark;
+}
+
+ParseTreeTracker::Mark ParseTreeTracker::markBefore(ParseTree *node) const {
+  Mark mark = { nullptr, reinterpret_cast<char *>(node), _destructible.size() };
+  if (!_destructible.empty() && _destructible.back() == node) {
+    --mark.destructibleCount;
+  }
+
+  for (Block *block = _blocks; block != nullptr; block = block->next) {
+    char *start = reinterpret_cast<char *>(block) + alignUp(sizeof(Block));
+    if (mark.cursor >= start && mark.cursor < start + block->size) {
+      mark.block = block;
+      return mark;
+    }
+  }
+  throw antlr4::IllegalArgumentException("The node was not created by this tracker");
+}
+
+void ParseTreeTracker::rewind(const Mark &mark) {
+  for (size_t i = mark.destructibleCount; i < _destructible.size(); ++i) {
+    _destructible[i]->~ParseTree();
+  }
+  _destructible.resize(mark.destructibleCount);
+
+  while (_blocks != mark.block) {
+    Block *next = _blocks->next;
+    ::operator delete(_blocks);
+    _blocks = next;
+  }
+  _cursor = mark.cursor;
+  _limit = _blocks == nullptr ? nullptr : reinterpret_cast<char *>(_blocks) + alignUp(sizeof(Block)) + _blocks->size;
+}
+
+bool ParseTreeTracker::isAfter(const Mark &mark, const void *memory) const {
+  // Blocks are listed newest first, so all blocks before the marked one are newer than the mark.
+  const char *address = static_cast<const char *>(memory);
+  for (Block *block = _blocks; block != nullptr; block = block->next) {
+    const char *start = reinterpret_cast<const char *>(block) + alignUp(sizeof(Block));
+    if (block == mark.block) {
+      return address >= mark.cursor && address < start + block->size;
+    }
+    if (address >= start && address < start + block->size) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//------------------ ParseTree -----------------------------------------------------------------------------------------
+
+ParseTree::ParseTree() : parent(nullptr), _treeType(ParseTreeType::RULE) {
+}
+
+ParseTree::ParseTree(ParseTreeType type) : parent(nullptr), _treeType(type) {
 }
 
 bool ParseTree::operator == (const ParseTree &other) const {
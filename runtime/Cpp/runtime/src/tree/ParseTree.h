@@ -10,6 +10,79 @@
 namespace antlr4 {
 namespace tree {
 
+  class ParseTreeTracker;
+
+  /// The list of children of a parse tree node. It behaves like the std::vector<ParseTree *> it replaces
+  /// (and converts to one), but once attached to a ParseTreeTracker it takes its memory from the tracker's
+  /// arena. Growing then leaves the old array behind in the arena, which is released with the whole tree.
+  class ANTLR4CPP_PUBLIC ParseTreeChildren {
+  public:
+    typedef ParseTree* value_type;
+    typedef ParseTree** iterator;
+    typedef ParseTree* const* const_iterator;
+
+    ParseTreeChildren();
+    ParseTreeChildren(std::initializer_list<ParseTree *> list);
+    ParseTreeChildren(const ParseTreeChildren &other);
+    ~ParseTreeChildren();
+
+    ParseTreeChildren& operator = (const ParseTreeChildren &other);
+    ParseTreeChildren& operator = (std::initializer_list<ParseTree *> list);
+
+    operator std::vector<ParseTree *>() const {
+      return std::vector<ParseTree *>(begin(), end());
+    }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    ParseTree*& operator [] (size_t index) { return _data[index]; }
+    ParseTree* operator [] (size_t index) const { return _data[index]; }
+    ParseTree*& front() { return _data[0]; }
+    ParseTree*& back() { return _data[_size - 1]; }
+
+    iterator begin() { return _data; }
+    iterator end() { return _data + _size; }
+    const_iterator begin() const { return _data; }
+    const_iterator end() const { return _data + _size; }
+
+    void push_back(ParseTree *tree) {
+      if (_size == _capacity) {
+        grow(_size + 1);
+      }
+      _data[_size++] = tree;
+    }
+
+    void pop_back() { --_size; }
+    void clear() { _size = 0; }
+
+    iterator erase(const_iterator position);
+    iterator erase(const_iterator first, const_iterator last);
+    void reserve(size_t capacity);
+    void shrink_to_fit();
+
+    /// Moves the children into the tracker's arena. All further allocations come from there too.
+    void attach(ParseTreeTracker *tracker);
+
+  private:
+    ParseTree **_data;
+    size_t _size;
+    size_t _capacity;
+    ParseTreeTracker *_tracker; // Null if the memory comes from the heap.
+
+    void grow(size_t minimum);
+    void assign(const_iterator first, const_iterator last);
+    void setStorage(size_t capacity);
+  };
+
+  /// The kind of a parse tree node. It is stored in the node, so tree walkers can tell rule contexts, terminals
+  /// and error nodes apart without a dynamic_cast.
+  enum class ParseTreeType {
+    RULE,
+    TERMINAL,
+    ERROR_NODE // Error nodes are terminals too.
+  };
+
   /// An interface to access the tree of <seealso cref="RuleContext"/> objects created
   /// during a parse that makes the data structure look like a simple parse tree.
   /// This node represents both internal nodes, rule invocations,
@@ -20,6 +93,7 @@ namespace tree {
   class ANTLR4CPP_PUBLIC ParseTree {
   public:
     ParseTree();
+    explicit ParseTree(ParseTreeType type);
     ParseTree(ParseTree const&) = delete;
     virtual ~ParseTree() {}
 
@@ -35,7 +109,7 @@ namespace tree {
     /// operation because we don't the need to track the details about
     /// how we parse this rule.
     // ml: memory is not managed here, but by the owning class. This is just for the structure.
-    std::vector<ParseTree *> children;
+    ParseTreeChildren children;
 
     /// Print out a whole tree, not just a node, in LISP format
     /// {@code (root child1 .. childN)}. Print just a node if this is a leaf.
@@ -74,27 +148,88 @@ namespace tree {
      * EOF is unspecified.</p>
      */
     virtual misc::Interval getSourceInterval() = 0;
+
+    ParseTreeType getTreeType() const {
+      return _treeType;
+    }
+
+  protected:
+    ParseTreeType _treeType;
+  };
+
+  /// Parse tree types whose destructor has nothing to do when the node was created by a ParseTreeTracker
+  /// (i.e. with its children in the arena). The tracker skips the destructor call for such types.
+  template<typename T>
+  struct IsTriviallyReleasable : std::false_type {
   };
 
   // A class to help managing ParseTree instances without the need of a shared_ptr.
+  // All nodes are placed in a monotonic arena (a list of large blocks) owned by the tracker (and hence by
+  // the parser). reset() releases the whole tree at once: the destructors of nodes which need it are run,
+  // then the arena is rewound.
   class ANTLR4CPP_PUBLIC ParseTreeTracker {
   public:
+    static const size_t BLOCK_SIZE = 64 * 1024;
+
+    ParseTreeTracker();
+    ParseTreeTracker(const ParseTreeTracker &other) = delete;
+    ~ParseTreeTracker();
+
+    ParseTreeTracker& operator = (const ParseTreeTracker &other) = delete;
+
     template<typename T, typename ... Args>
     T* createInstance(Args&& ... args) {
       static_assert(std::is_base_of<ParseTree, T>::value, "Argument must be a parse tree type");
-      T* result = new T(args...);
-      _allocated.push_back(result);
+      void *memory = allocate(sizeof(T));
+      T* result = new (memory) T(std::forward<Args>(args)...);
+      result->children.attach(this);
+      if (!IsTriviallyReleasable<T>::value) {
+        _destructible.push_back(result);
+      }
       return result;
     }
 
-    void reset() {
-      for (auto entry : _allocated)
-        delete entry;
-      _allocated.clear();
-    }
+    /// Returns uninitialized memory from the arena, aligned for any parse tree type.
+    void* allocate(size_t size);
+
+    void reset();
 
   private:
-    std::vector<ParseTree *> _allocated;
+    struct Block;
+
+  public:
+    /// A position in the arena, see rewind().
+    struct Mark {
+      Block *block;
+      char *cursor;
+      size_t destructibleCount;
+    };
+
+    /// Returns a mark for the current position.
+    Mark mark() const;
+
+    /// Returns a mark for the position right before the given node, which must be the node created last
+    /// (allocations for child lists may have happened after it).
+    Mark markBefore(ParseTree *node) const;
+
+    /// Releases everything allocated after the mark, running the destructors of the nodes as in reset().
+    /// Nothing which remains in use may refer to the released nodes and child lists.
+    void rewind(const Mark &mark);
+
+    /// Returns true if the given arena memory was allocated after the mark.
+    bool isAfter(const Mark &mark, const void *memory) const;
+
+  private:
+    struct Block {
+      Block *next;
+      size_t size;
+    };
+
+    Block *_blocks;
+    char *_cursor;
+    char *_limit;
+
+    std::vector<ParseTree *> _destructible;
   };
 
 
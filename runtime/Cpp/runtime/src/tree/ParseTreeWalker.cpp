@@ -7,6 +7,7 @@
 #include "ParserRuleContext.h"
 #include "tree/ParseTreeListener.h"
 #include "support/CPPUtils.h"
+#include "tree/RuleDispatchTable.h"
 
 #include "tree/IterativeParseTreeWalker.h"
 #include "tree/ParseTreeWalker.h"
@@ -21,12 +22,18 @@ ParseTreeWalker::~ParseTreeWalker() {
 }
 
 void ParseTreeWalker::walk(ParseTreeListener *listener, ParseTree *t) const {
-  if (is<ErrorNode *>(t)) {
-    listener->visitErrorNode(dynamic_cast<ErrorNode *>(t));
-    return;
-  } else if (is<TerminalNode *>(t)) {
-    listener->visitTerminal(dynamic_cast<TerminalNode *>(t));
-    return;
+  switch (t->getTreeType()) {
+    case ParseTreeType::ERROR_NODE:
+      // ErrorNode is derived virtually from TerminalNode, which rules out a static_cast.
+      listener->visitErrorNode(dynamic_cast<ErrorNode *>(t));
+      return;
+
+    case ParseTreeType::TERMINAL:
+      listener->visitTerminal(static_cast<TerminalNode *>(t));
+      return;
+
+    default:
+      break;
   }
 
   enterRule(listener, t);
@@ -36,14 +43,74 @@ void ParseTreeWalker::walk(ParseTreeListener *listener, ParseTree *t) const {
   exitRule(listener, t);
 }
 
+void ParseTreeWalker::walk(const RuleDispatchTable &table, ParseTreeListener *listener, ParseTree *t) const {
+  struct Frame {
+    ParserRuleContext *ctx;
+    size_t childIndex;
+    RuleDispatchTable::ExitHandler exit;
+  };
+
+  std::vector<Frame> stack;
+  stack.reserve(64);
+
+  ParseTree *node = t;
+  while (node != nullptr) {
+    switch (node->getTreeType()) {
+      case ParseTreeType::RULE: {
+        ParserRuleContext *ctx = static_cast<ParserRuleContext *>(node);
+        size_t ruleIndex = ctx->getRuleIndex();
+        RuleDispatchTable::EnterHandler enter = table.getEnterHandler(ruleIndex);
+        RuleDispatchTable::ExitHandler exit = table.getExitHandler(ruleIndex);
+
+        if ((enter == nullptr || enter(listener, ctx)) && !ctx->children.empty()) {
+          stack.push_back({ ctx, 0, exit });
+          node = ctx->children[0];
+          continue;
+        }
+        if (exit != nullptr) {
+          exit(listener, ctx);
+        }
+        break;
+      }
+
+      case ParseTreeType::TERMINAL:
+        if (table.getTerminalHandler() != nullptr) {
+          table.getTerminalHandler()(listener, static_cast<TerminalNode *>(node));
+        }
+        break;
+
+      case ParseTreeType::ERROR_NODE:
+        if (table.getErrorNodeHandler() != nullptr) {
+          table.getErrorNodeHandler()(listener, dynamic_cast<ErrorNode *>(node));
+        }
+        break;
+    }
+
+    // The node is done, continue with the next sibling or go up.
+    node = nullptr;
+    while (!stack.empty()) {
+      Frame &frame = stack.back();
+      if (++frame.childIndex < frame.ctx->children.size()) {
+        node = frame.ctx->children[frame.childIndex];
+        break;
+      }
+
+      if (frame.exit != nullptr) {
+        frame.exit(listener, frame.ctx);
+      }
+      stack.pop_back();
+    }
+  }
+}
+
 void ParseTreeWalker::enterRule(ParseTreeListener *listener, ParseTree *r) const {
-  ParserRuleContext *ctx = dynamic_cast<ParserRuleContext *>(r);
+  ParserRuleContext *ctx = static_cast<ParserRuleContext *>(r);
   listener->enterEveryRule(ctx);
   ctx->enterRule(listener);
 }
 
 void ParseTreeWalker::exitRule(ParseTreeListener *listener, ParseTree *r) const {
-  ParserRuleContext *ctx = dynamic_cast<ParserRuleContext *>(r);
+  ParserRuleContext *ctx = static_cast<ParserRuleContext *>(r);
   ctx->exitRule(listener);
   listener->exitEveryRule(ctx);
 }
@@ -18,6 +18,12 @@ namespace tree {
 
     virtual void walk(ParseTreeListener *listener, ParseTree *t) const;
 
+    /// Walks the tree iteratively and calls the handlers of the table for the listener, instead of the
+    /// listener's enterEveryRule() etc. and the contexts' enterRule()/exitRule(). Subtrees are skipped when
+    /// an enter handler returns false. Memory is only allocated when the tree is deeper than any tree before
+    /// in this walk (for the stack of open nodes), not per node.
+    void walk(const RuleDispatchTable &table, ParseTreeListener *listener, ParseTree *t) const;
+
   protected:
     /// The discovery of a rule node, involves sending two events: the generic
     /// <seealso cref="ParseTreeListener#enterEveryRule"/> and a
@@ -0,0 +1,34 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "tree/RuleDispatchTable.h"
+
+using namespace antlr4::tree;
+
+RuleDispatchTable::RuleDispatchTable() : _terminalHandler(nullptr), _errorNodeHandler(nullptr) {
+}
+
+void RuleDispatchTable::setEnterHandler(size_t ruleIndex, EnterHandler handler) {
+  entryFor(ruleIndex).enter = handler;
+}
+
+void RuleDispatchTable::setExitHandler(size_t ruleIndex, ExitHandler handler) {
+  entryFor(ruleIndex).exit = handler;
+}
+
+void RuleDispatchTable::setTerminalHandler(TerminalHandler handler) {
+  _terminalHandler = handler;
+}
+
+void RuleDispatchTable::setErrorNodeHandler(ErrorNodeHandler handler) {
+  _errorNodeHandler = handler;
+}
+
+RuleDispatchTable::Entry& RuleDispatchTable::entryFor(size_t ruleIndex) {
+  if (ruleIndex >= _entries.size()) {
+    _entries.resize(ruleIndex + 1, { nullptr, nullptr });
+  }
+  return _entries[ruleIndex];
+}
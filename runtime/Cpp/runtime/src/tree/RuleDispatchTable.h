@@ -0,0 +1,128 @@
+/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#pragma once
+
+#include "antlr4-common.h"
+
+namespace antlr4 {
+namespace tree {
+
+  /// Maps rule indexes to the enter and exit handlers of one listener class. ParseTreeWalker::walk(table, ...)
+  /// calls them with one indexed lookup per node, instead of the enterEveryRule()/exitEveryRule() calls plus the
+  /// virtual ParserRuleContext::enterRule()/exitRule() of the generated contexts (which dynamic_cast the listener).
+  /// An enter handler can return false to skip the children of a node (its exit handler is still called).
+  ///
+  /// Nodes without a handler are passed silently, the listener's visitTerminal(), enterEveryRule() etc. are not
+  /// used. Build the table once per listener class and share it between walks and threads, e.g.:
+  ///
+  ///   static const RuleDispatchTable table = [] {
+  ///     RuleDispatchTable result;
+  ///     result.onEnter<MyListener, MyParser::ExprContext, &MyListener::enterExpr>(MyParser::RuleExpr);
+  ///     result.onExit<MyListener, MyParser::ExprContext, &MyListener::exitExpr>(MyParser::RuleExpr);
+  ///     return result;
+  ///   }();
+  ///   ParseTreeWalker::DEFAULT.walk(table, &listener, tree);
+  ///
+  /// Handlers with the return type bool (instead of void) for onEnter() control pruning.
+  class ANTLR4CPP_PUBLIC RuleDispatchTable {
+  public:
+    /// Returns false if the children of ctx should not be walked.
+    typedef bool (*EnterHandler)(ParseTreeListener *listener, ParserRuleContext *ctx);
+    typedef void (*ExitHandler)(ParseTreeListener *listener, ParserRuleContext *ctx);
+    typedef void (*TerminalHandler)(ParseTreeListener *listener, TerminalNode *node);
+    typedef void (*ErrorNodeHandler)(ParseTreeListener *listener, ErrorNode *node);
+
+    RuleDispatchTable();
+
+    void setEnterHandler(size_t ruleIndex, EnterHandler handler);
+    void setExitHandler(size_t ruleIndex, ExitHandler handler);
+    void setTerminalHandler(TerminalHandler handler);
+    void setErrorNodeHandler(ErrorNodeHandler handler);
+
+    EnterHandler getEnterHandler(size_t ruleIndex) const {
+      return ruleIndex < _entries.size() ? _entries[ruleIndex].enter : nullptr;
+    }
+
+    ExitHandler getExitHandler(size_t ruleIndex) const {
+      return ruleIndex < _entries.size() ? _entries[ruleIndex].exit : nullptr;
+    }
+
+    TerminalHandler getTerminalHandler() const {
+      return _terminalHandler;
+    }
+
+    ErrorNodeHandler getErrorNodeHandler() const {
+      return _errorNodeHandler;
+    }
+
+    template<typename Listener, typename Context, void (Listener::*Method)(Context *)>
+    void onEnter(size_t ruleIndex) {
+      setEnterHandler(ruleIndex, &enterThunk<Listener, Context, Method>);
+    }
+
+    template<typename Listener, typename Context, bool (Listener::*Method)(Context *)>
+    void onEnter(size_t ruleIndex) {
+      setEnterHandler(ruleIndex, &pruningEnterThunk<Listener, Context, Method>);
+    }
+
+    template<typename Listener, typename Context, void (Listener::*Method)(Context *)>
+    void onExit(size_t ruleIndex) {
+      setExitHandler(ruleIndex, &exitThunk<Listener, Context, Method>);
+    }
+
+    template<typename Listener, void (Listener::*Method)(TerminalNode *)>
+    void onTerminal() {
+      setTerminalHandler(&terminalThunk<Listener, Method>);
+    }
+
+    template<typename Listener, void (Listener::*Method)(ErrorNode *)>
+    void onErrorNode() {
+      setErrorNodeHandler(&errorNodeThunk<Listener, Method>);
+    }
+
+  private:
+    struct Entry {
+      EnterHandler enter;
+      ExitHandler exit;
+    };
+
+    std::vector<Entry> _entries;
+    TerminalHandler _terminalHandler;
+    ErrorNodeHandler _errorNodeHandler;
+
+    Entry& entryFor(size_t ruleIndex);
+
+    // Listeners and contexts are downcast statically, the walker only calls a handler for the rule index it
+    // was registered for.
+    template<typename Listener, typename Context, void (Listener::*Method)(Context *)>
+    static bool enterThunk(ParseTreeListener *listener, ParserRuleContext *ctx) {
+      (static_cast<Listener *>(listener)->*Method)(static_cast<Context *>(ctx));
+      return true;
+    }
+
+    template<typename Listener, typename Context, bool (Listener::*Method)(Context *)>
+    static bool pruningEnterThunk(ParseTreeListener *listener, ParserRuleContext *ctx) {
+      return (static_cast<Listener *>(listener)->*Method)(static_cast<Context *>(ctx));
+    }
+
+    template<typename Listener, typename Context, void (Listener::*Method)(Context *)>
+    static void exitThunk(ParseTreeListener *listener, ParserRuleContext *ctx) {
+      (static_cast<Listener *>(listener)->*Method)(static_cast<Context *>(ctx));
+    }
+
+    template<typename Listener, void (Listener::*Method)(TerminalNode *)>
+    static void terminalThunk(ParseTreeListener *listener, TerminalNode *node) {
+      (static_cast<Listener *>(listener)->*Method)(node);
+    }
+
+    template<typename Listener, void (Listener::*Method)(ErrorNode *)>
+    static void errorNodeThunk(ParseTreeListener *listener, ErrorNode *node) {
+      (static_cast<Listener *>(listener)->*Method)(node);
+    }
+  };
+
+} // namespace tree
+} // namespace antlr4
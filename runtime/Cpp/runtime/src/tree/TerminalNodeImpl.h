@@ -29,5 +29,10 @@ namespace tree {
 
   };
 
+  // Terminal nodes own nothing, a ParseTreeTracker can drop them without calling their destructor.
+  template<>
+  struct IsTriviallyReleasable<TerminalNodeImpl> : std::true_type {
+  };
+
 } // namespace tree
 } // namespace antlr4
@@ -40,7 +40,6 @@ private:
   static std::vector<std::string> _symbolicNames;
   static antlr4::dfa::Vocabulary _vocabulary;
   static antlr4::atn::ATN _atn;
-  static std::vector<uint16_t> _serializedATN;
 
 
   // Individual action functions triggered by action() above.
@@ -48,9 +47,8 @@ private:
 
   // Individual semantic predicate functions triggered by sempred() above.
 
-  struct Initializer {
-    Initializer();
-  };
-  static Initializer _init;
+  // The ATN is deserialized when the first instance is created, not during static initialization.
+  static std::once_flag _initialized;
+  static void initialize();
 };
 